@@ -0,0 +1,9 @@
+var searchData=
+[
+  ['accept_0',['Accept',['../classtinyxml2_1_1_x_m_l_node.html#a81e66df0a44c67a7af17f3b77a152785',1,'tinyxml2::XMLNode::Accept()'],['../classtinyxml2_1_1_x_m_l_text.html#a4022fa0089f2964203c7a69cd0f3726f',1,'tinyxml2::XMLText::Accept()'],['../classtinyxml2_1_1_x_m_l_comment.html#a171ccb71232b90cd0d6945b92cfc4aec',1,'tinyxml2::XMLComment::Accept()'],['../classtinyxml2_1_1_x_m_l_declaration.html#afd861abee3ed6c88e9a6965dac32f8b7',1,'tinyxml2::XMLDeclaration::Accept()'],['../classtinyxml2_1_1_x_m_l_unknown.html#ab510bfaa18873a3968964655353d2946',1,'tinyxml2::XMLUnknown::Accept()'],['../classtinyxml2_1_1_x_m_l_element.html#acae4a763d74c13ce4a31eb70b4db9f82',1,'tinyxml2::XMLElement::Accept()'],['../classtinyxml2_1_1_x_m_l_document.html#a853f05e2f7f51eb598e32ec61d8bc53c',1,'tinyxml2::XMLDocument::Accept()']]],
+  ['an_20xml_20file_1',['Load an XML File',['../_example_1.html',1,'']]],
+  ['an_20xml_20from_20char_20buffer_2',['Parse an XML from char buffer',['../_example_2.html',1,'']]],
+  ['and_20text_20information_3',['Read attributes and text information.',['../_example_4.html',1,'']]],
+  ['attribute_4',['Attribute',['../classtinyxml2_1_1_x_m_l_element.html#a48cf4a315cfbac7d74cd0d5ff2c5df51',1,'tinyxml2::XMLElement']]],
+  ['attributes_20and_20text_20information_5',['Read attributes and text information.',['../_example_4.html',1,'']]]
+];
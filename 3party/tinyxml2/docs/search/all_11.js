@@ -0,0 +1,12 @@
+var searchData=
+[
+  ['text_20information_0',['Read attributes and text information.',['../_example_4.html',1,'']]],
+  ['tinyxml_202_1',['TinyXML-2',['../index.html',1,'']]],
+  ['tocomment_2',['ToComment',['../classtinyxml2_1_1_x_m_l_node.html#a5dc13f02ae49e3fa609e426f47c8466d',1,'tinyxml2::XMLNode::ToComment()'],['../classtinyxml2_1_1_x_m_l_comment.html#a7bd0df98fc2bb55d1d4445bfd2ec0053',1,'tinyxml2::XMLComment::ToComment()']]],
+  ['todeclaration_3',['ToDeclaration',['../classtinyxml2_1_1_x_m_l_node.html#a12aa783a3a4445ad5557c7d56cd8dc4a',1,'tinyxml2::XMLNode::ToDeclaration()'],['../classtinyxml2_1_1_x_m_l_declaration.html#ac485f175252b0d838d86de5fa22455cd',1,'tinyxml2::XMLDeclaration::ToDeclaration()'],['../classtinyxml2_1_1_x_m_l_handle.html#a85d0c76920a013ea2a29456dbf7d160d',1,'tinyxml2::XMLHandle::ToDeclaration()']]],
+  ['todocument_4',['ToDocument',['../classtinyxml2_1_1_x_m_l_node.html#a6107c3f57ab6e0755959947762953652',1,'tinyxml2::XMLNode::ToDocument()'],['../classtinyxml2_1_1_x_m_l_document.html#a290ad241e05e6aeeccbc78a4f3454f55',1,'tinyxml2::XMLDocument::ToDocument()']]],
+  ['toelement_5',['ToElement',['../classtinyxml2_1_1_x_m_l_node.html#a9417e1f8a9787ae27741605493514b18',1,'tinyxml2::XMLNode::ToElement()'],['../classtinyxml2_1_1_x_m_l_element.html#a88621376780280c0695458e30212eebe',1,'tinyxml2::XMLElement::ToElement()'],['../classtinyxml2_1_1_x_m_l_handle.html#ab2371c4adb8b04afe04ed216bf9b0676',1,'tinyxml2::XMLHandle::ToElement()']]],
+  ['tonode_6',['ToNode',['../classtinyxml2_1_1_x_m_l_handle.html#a689453c96dd3d4016437d2298d1de691',1,'tinyxml2::XMLHandle']]],
+  ['totext_7',['ToText',['../classtinyxml2_1_1_x_m_l_node.html#a0aea8c9c5853c35a06da1988486abc60',1,'tinyxml2::XMLNode::ToText()'],['../classtinyxml2_1_1_x_m_l_text.html#a221e45ee1026407049d89786cbbfe145',1,'tinyxml2::XMLText::ToText()'],['../classtinyxml2_1_1_x_m_l_handle.html#accc80bcbd81e816f13a23c172587c288',1,'tinyxml2::XMLHandle::ToText()']]],
+  ['tounknown_8',['ToUnknown',['../classtinyxml2_1_1_x_m_l_node.html#aa8a2dd38b786c3b8d406c2047753cbfd',1,'tinyxml2::XMLNode::ToUnknown()'],['../classtinyxml2_1_1_x_m_l_unknown.html#a7d2238fe165736605de3ba2e2e5a99d1',1,'tinyxml2::XMLUnknown::ToUnknown()'],['../classtinyxml2_1_1_x_m_l_handle.html#add97784cbe14ef42bb36e158ad6e6082',1,'tinyxml2::XMLHandle::ToUnknown()']]]
+];
@@ -0,0 +1,7 @@
+var searchData=
+[
+  ['value_0',['Value',['../classtinyxml2_1_1_x_m_l_node.html#a0485e51c670e741884cfd8362274d680',1,'tinyxml2::XMLNode::Value()'],['../classtinyxml2_1_1_x_m_l_attribute.html#ab1c5cd993f836a771818ca408994b14e',1,'tinyxml2::XMLAttribute::Value()']]],
+  ['visit_1',['Visit',['../classtinyxml2_1_1_x_m_l_visitor.html#adc75bd459fc7ba8223b50f0616767f9a',1,'tinyxml2::XMLVisitor::Visit(const XMLDeclaration &amp;)'],['../classtinyxml2_1_1_x_m_l_visitor.html#af30233565856480ea48b6fa0d6dec65b',1,'tinyxml2::XMLVisitor::Visit(const XMLText &amp;)'],['../classtinyxml2_1_1_x_m_l_visitor.html#acc8147fb5a85f6c65721654e427752d7',1,'tinyxml2::XMLVisitor::Visit(const XMLComment &amp;)'],['../classtinyxml2_1_1_x_m_l_visitor.html#a14e4748387c34bf53d24e8119bb1f292',1,'tinyxml2::XMLVisitor::Visit(const XMLUnknown &amp;)'],['../classtinyxml2_1_1_x_m_l_printer.html#ad903ea1672831f797130b4cddddfa532',1,'tinyxml2::XMLPrinter::Visit(const XMLText &amp;text) override'],['../classtinyxml2_1_1_x_m_l_printer.html#a76fe434cdd4c39cb9963e3025e53609a',1,'tinyxml2::XMLPrinter::Visit(const XMLComment &amp;comment) override'],['../classtinyxml2_1_1_x_m_l_printer.html#a63df55647c0e170e5b8702842b82008e',1,'tinyxml2::XMLPrinter::Visit(const XMLDeclaration &amp;declaration) override'],['../classtinyxml2_1_1_x_m_l_printer.html#a31002765840bc4ea7b22332f71d83c74',1,'tinyxml2::XMLPrinter::Visit(const XMLUnknown &amp;unknown) override']]],
+  ['visitenter_2',['VisitEnter',['../classtinyxml2_1_1_x_m_l_visitor.html#acb3c22fc5f60eb9db98f533f2761f67d',1,'tinyxml2::XMLVisitor::VisitEnter(const XMLDocument &amp;)'],['../classtinyxml2_1_1_x_m_l_visitor.html#af97980a17dd4e37448b181f5ddfa92b5',1,'tinyxml2::XMLVisitor::VisitEnter(const XMLElement &amp;, const XMLAttribute *)'],['../classtinyxml2_1_1_x_m_l_printer.html#a73eba3d1aab34c4c3ac38d7d2d186671',1,'tinyxml2::XMLPrinter::VisitEnter(const XMLDocument &amp;) override'],['../classtinyxml2_1_1_x_m_l_printer.html#a5cab997d51b0387c21e2274bd1147755',1,'tinyxml2::XMLPrinter::VisitEnter(const XMLElement &amp;element, const XMLAttribute *attribute) override']]],
+  ['visitexit_3',['VisitExit',['../classtinyxml2_1_1_x_m_l_visitor.html#a170e9989cd046ba904f302d087e07086',1,'tinyxml2::XMLVisitor::VisitExit(const XMLDocument &amp;)'],['../classtinyxml2_1_1_x_m_l_visitor.html#a772f10ddc83f881956d32628faa16eb6',1,'tinyxml2::XMLVisitor::VisitExit(const XMLElement &amp;)'],['../classtinyxml2_1_1_x_m_l_printer.html#a261a24986e3507258a74405a7dc08cbf',1,'tinyxml2::XMLPrinter::VisitExit(const XMLDocument &amp;) override'],['../classtinyxml2_1_1_x_m_l_printer.html#a9a397f4c809a4de7ba27902b3ae1bbf7',1,'tinyxml2::XMLPrinter::VisitExit(const XMLElement &amp;element) override']]]
+];
@@ -0,0 +1,18 @@
+var searchData=
+[
+  ['xml_0',['Get information out of XML',['../_example_3.html',1,'']]],
+  ['xml_20file_1',['Load an XML File',['../_example_1.html',1,'']]],
+  ['xml_20from_20char_20buffer_2',['Parse an XML from char buffer',['../_example_2.html',1,'']]],
+  ['xmlattribute_3',['XMLAttribute',['../classtinyxml2_1_1_x_m_l_attribute.html',1,'tinyxml2']]],
+  ['xmlcomment_4',['XMLComment',['../classtinyxml2_1_1_x_m_l_comment.html',1,'tinyxml2']]],
+  ['xmlconsthandle_5',['XMLConstHandle',['../classtinyxml2_1_1_x_m_l_const_handle.html',1,'tinyxml2']]],
+  ['xmldeclaration_6',['XMLDeclaration',['../classtinyxml2_1_1_x_m_l_declaration.html',1,'tinyxml2']]],
+  ['xmldocument_7',['XMLDocument',['../classtinyxml2_1_1_x_m_l_document.html',1,'tinyxml2::XMLDocument'],['../classtinyxml2_1_1_x_m_l_document.html#a57ddf17b6e054dda10af98991b1b8f70',1,'tinyxml2::XMLDocument::XMLDocument()']]],
+  ['xmlelement_8',['XMLElement',['../classtinyxml2_1_1_x_m_l_element.html',1,'tinyxml2']]],
+  ['xmlhandle_9',['XMLHandle',['../classtinyxml2_1_1_x_m_l_handle.html',1,'tinyxml2::XMLHandle'],['../classtinyxml2_1_1_x_m_l_handle.html#a9c240a35c18f053509b4b97ddccd9793',1,'tinyxml2::XMLHandle::XMLHandle(XMLNode *node)'],['../classtinyxml2_1_1_x_m_l_handle.html#aa2edbc1c0d3e3e8259bd98de7f1cf500',1,'tinyxml2::XMLHandle::XMLHandle(XMLNode &amp;node)'],['../classtinyxml2_1_1_x_m_l_handle.html#afd8e01e6018c07347b8e6d80272466aa',1,'tinyxml2::XMLHandle::XMLHandle(const XMLHandle &amp;ref)']]],
+  ['xmlnode_10',['XMLNode',['../classtinyxml2_1_1_x_m_l_node.html',1,'tinyxml2']]],
+  ['xmlprinter_11',['XMLPrinter',['../classtinyxml2_1_1_x_m_l_printer.html',1,'tinyxml2::XMLPrinter'],['../classtinyxml2_1_1_x_m_l_printer.html#aa6d3841c069085f5b8a27bc7103c04f7',1,'tinyxml2::XMLPrinter::XMLPrinter()']]],
+  ['xmltext_12',['XMLText',['../classtinyxml2_1_1_x_m_l_text.html',1,'tinyxml2']]],
+  ['xmlunknown_13',['XMLUnknown',['../classtinyxml2_1_1_x_m_l_unknown.html',1,'tinyxml2']]],
+  ['xmlvisitor_14',['XMLVisitor',['../classtinyxml2_1_1_x_m_l_visitor.html',1,'tinyxml2']]]
+];
@@ -0,0 +1,17 @@
+var searchData=
+[
+  ['information_0',['Read attributes and text information.',['../_example_4.html',1,'']]],
+  ['information_20out_20of_20xml_1',['Get information out of XML',['../_example_3.html',1,'']]],
+  ['insertafterchild_2',['InsertAfterChild',['../classtinyxml2_1_1_x_m_l_node.html#a9275138a1b8dd5d8e2c26789bdc23ac8',1,'tinyxml2::XMLNode']]],
+  ['insertendchild_3',['InsertEndChild',['../classtinyxml2_1_1_x_m_l_node.html#ae3b422e98914d6002ca99bb1d2837103',1,'tinyxml2::XMLNode']]],
+  ['insertfirstchild_4',['InsertFirstChild',['../classtinyxml2_1_1_x_m_l_node.html#ac609a8f3ea949027f439280c640bbaf2',1,'tinyxml2::XMLNode']]],
+  ['insertnewchildelement_5',['InsertNewChildElement',['../classtinyxml2_1_1_x_m_l_element.html#abf01fdeb702165fddbc97bcc8af8a1ad',1,'tinyxml2::XMLElement']]],
+  ['insertnewcomment_6',['InsertNewComment',['../classtinyxml2_1_1_x_m_l_element.html#aaed36d3a8082b083ec4f1de55ee68cc2',1,'tinyxml2::XMLElement']]],
+  ['insertnewdeclaration_7',['InsertNewDeclaration',['../classtinyxml2_1_1_x_m_l_element.html#a7f11671a928649add7e3e18de7adf84a',1,'tinyxml2::XMLElement']]],
+  ['insertnewtext_8',['InsertNewText',['../classtinyxml2_1_1_x_m_l_element.html#ac30367a5e25ff30e178b56e0e1456d23',1,'tinyxml2::XMLElement']]],
+  ['insertnewunknown_9',['InsertNewUnknown',['../classtinyxml2_1_1_x_m_l_element.html#afe6cfefb48f8fbcb29a790f2042b55a4',1,'tinyxml2::XMLElement']]],
+  ['int64attribute_10',['Int64Attribute',['../classtinyxml2_1_1_x_m_l_element.html#a66d96972adecd816194191f13cc4a0a0',1,'tinyxml2::XMLElement']]],
+  ['int64text_11',['Int64Text',['../classtinyxml2_1_1_x_m_l_element.html#aab6151f7e3b4c2c0a8234e262d7b6b8a',1,'tinyxml2::XMLElement']]],
+  ['intattribute_12',['IntAttribute',['../classtinyxml2_1_1_x_m_l_element.html#a95a89b13bb14a2d4655e2b5b406c00d4',1,'tinyxml2::XMLElement']]],
+  ['intvalue_13',['IntValue',['../classtinyxml2_1_1_x_m_l_attribute.html#adfa2433f0fdafd5c3880936de9affa80',1,'tinyxml2::XMLAttribute']]]
+];
@@ -0,0 +1,7 @@
+var searchData=
+[
+  ['of_20xml_0',['Get information out of XML',['../_example_3.html',1,'']]],
+  ['openelement_1',['OpenElement',['../classtinyxml2_1_1_x_m_l_printer.html#a20fb06c83bd13e5140d7dd13af06c010',1,'tinyxml2::XMLPrinter']]],
+  ['operator_3d_2',['operator=',['../classtinyxml2_1_1_x_m_l_handle.html#aa07c9a53f78d7b2dc1018668641521d8',1,'tinyxml2::XMLHandle']]],
+  ['out_20of_20xml_3',['Get information out of XML',['../_example_3.html',1,'']]]
+];
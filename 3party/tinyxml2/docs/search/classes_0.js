@@ -0,0 +1,15 @@
+var searchData=
+[
+  ['xmlattribute_0',['XMLAttribute',['../classtinyxml2_1_1_x_m_l_attribute.html',1,'tinyxml2']]],
+  ['xmlcomment_1',['XMLComment',['../classtinyxml2_1_1_x_m_l_comment.html',1,'tinyxml2']]],
+  ['xmlconsthandle_2',['XMLConstHandle',['../classtinyxml2_1_1_x_m_l_const_handle.html',1,'tinyxml2']]],
+  ['xmldeclaration_3',['XMLDeclaration',['../classtinyxml2_1_1_x_m_l_declaration.html',1,'tinyxml2']]],
+  ['xmldocument_4',['XMLDocument',['../classtinyxml2_1_1_x_m_l_document.html',1,'tinyxml2']]],
+  ['xmlelement_5',['XMLElement',['../classtinyxml2_1_1_x_m_l_element.html',1,'tinyxml2']]],
+  ['xmlhandle_6',['XMLHandle',['../classtinyxml2_1_1_x_m_l_handle.html',1,'tinyxml2']]],
+  ['xmlnode_7',['XMLNode',['../classtinyxml2_1_1_x_m_l_node.html',1,'tinyxml2']]],
+  ['xmlprinter_8',['XMLPrinter',['../classtinyxml2_1_1_x_m_l_printer.html',1,'tinyxml2']]],
+  ['xmltext_9',['XMLText',['../classtinyxml2_1_1_x_m_l_text.html',1,'tinyxml2']]],
+  ['xmlunknown_10',['XMLUnknown',['../classtinyxml2_1_1_x_m_l_unknown.html',1,'tinyxml2']]],
+  ['xmlvisitor_11',['XMLVisitor',['../classtinyxml2_1_1_x_m_l_visitor.html',1,'tinyxml2']]]
+];
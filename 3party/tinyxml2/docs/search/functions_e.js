@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['rootelement_0',['RootElement',['../classtinyxml2_1_1_x_m_l_document.html#a0e6855771cbe87d839fb301d3646f5b8',1,'tinyxml2::XMLDocument']]]
+];
@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['2_0',['TinyXML-2',['../index.html',1,'']]]
+];
@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['load_20an_20xml_20file_0',['Load an XML File',['../_example_1.html',1,'']]]
+];
@@ -0,0 +1,4 @@
+var searchData=
+[
+  ['read_20attributes_20and_20text_20information_0',['Read attributes and text information.',['../_example_4.html',1,'']]]
+];
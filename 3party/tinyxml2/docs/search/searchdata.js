@@ -0,0 +1,24 @@
+var indexSectionsWithContent =
+{
+  0: "2abcdefghilnopqrstuvx",
+  1: "x",
+  2: "abcdefghilnopqrstuvx",
+  3: "2abcfgiloprtx"
+};
+
+var indexSectionNames =
+{
+  0: "all",
+  1: "classes",
+  2: "functions",
+  3: "pages"
+};
+
+var indexSectionLabels =
+{
+  0: "All",
+  1: "Classes",
+  2: "Functions",
+  3: "Pages"
+};
+
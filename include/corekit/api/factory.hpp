@@ -50,7 +50,7 @@ COREKIT_API void corekit_destroy_allocator(corekit::memory::IAllocator* allocato
 // Create an executor instance.
 COREKIT_API corekit::task::IExecutor* corekit_create_executor();
 
-// Create an executor instance with explicit options.
+// Create an executor instance with explicit options (worker count, policy, backend).
 COREKIT_API corekit::task::IExecutor* corekit_create_executor_v2(
     const corekit::task::ExecutorOptions* options);
 
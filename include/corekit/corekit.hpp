@@ -21,8 +21,12 @@
 #include "corekit/memory/i_memory_pool.hpp"
 #include "corekit/memory/i_object_pool.hpp"
 #include "corekit/memory/system_pool.hpp"
+#include "corekit/task/cancellation.hpp"
+#include "corekit/task/coroutine.hpp"
 #include "corekit/task/executor_helpers.hpp"
+#include "corekit/task/future.hpp"
 #include "corekit/task/iexecutor.hpp"
 #include "corekit/task/i_task_graph.hpp"
+#include "corekit/task/task_function.hpp"
 #include "corekit/xml/i_xml_doc.hpp"
 
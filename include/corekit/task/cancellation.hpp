@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// CancellationSource / CancellationToken
+//
+// 协作式取消：调用方持有 CancellationSource，把它发出的 CancellationToken 放进
+// TaskSubmitOptions::cancel_token 并（按需）捕获到任务体中。
+//   - 出队时令牌已取消的任务不会执行（按取消处理，计入 ExecutorStats::canceled）；
+//   - 已在运行的任务可轮询 IsCancellationRequested() 自行提前返回。
+// 一个 source 可发出任意多个令牌，Cancel() 对全部令牌立即可见且不可撤销。
+// 令牌可复制、线程安全；默认构造的令牌永远不会被取消。
+//
+// 典型用法：
+//   CancellationSource source;
+//   TaskSubmitOptions opt;
+//   opt.cancel_token = source.Token();
+//   CancellationToken token = opt.cancel_token;
+//   exec->SubmitEx([token] { while (!token.IsCancellationRequested()) step(); }, opt);
+//   ...
+//   source.Cancel();
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace detail {
+
+struct CancellationState {
+  CancellationState() : canceled(false) {}
+  std::atomic<bool> canceled;
+};
+
+}  // namespace detail
+
+class CancellationToken {
+ public:
+  CancellationToken() {}
+
+  // 是否已请求取消（无关联 source 时恒为 false）。
+  bool IsCancellationRequested() const {
+    return state_ && state_->canceled.load(std::memory_order_acquire);
+  }
+
+  // 是否关联了 source（即可能被取消）。
+  bool CanBeCanceled() const { return state_ != NULL; }
+
+ private:
+  friend class CancellationSource;
+  explicit CancellationToken(const std::shared_ptr<const detail::CancellationState>& state)
+      : state_(state) {}
+
+  std::shared_ptr<const detail::CancellationState> state_;
+};
+
+class CancellationSource {
+ public:
+  CancellationSource() : state_(std::make_shared<detail::CancellationState>()) {}
+
+  CancellationToken Token() const { return CancellationToken(state_); }
+
+  // 请求取消。幂等、线程安全。
+  void Cancel() { state_->canceled.store(true, std::memory_order_release); }
+
+  bool IsCancellationRequested() const {
+    return state_->canceled.load(std::memory_order_acquire);
+  }
+
+ private:
+  std::shared_ptr<detail::CancellationState> state_;
+};
+
+}  // namespace task
+}  // namespace corekit
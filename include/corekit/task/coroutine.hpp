@@ -0,0 +1,354 @@
+#pragma once
+
+// C++20 协程支持，仅在以 -DCOREKIT_ENABLE_COROUTINES=ON 构建时可用（该选项把工程切换到
+// C++20 并定义 COREKIT_ENABLE_COROUTINES=1）；C++14 构建下本头文件为空。
+#if defined(COREKIT_ENABLE_COROUTINES) && COREKIT_ENABLE_COROUTINES && \
+    defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "corekit/api/status.hpp"
+#include "corekit/ipc/i_channel.hpp"
+#include "corekit/task/future.hpp"
+#include "corekit/task/iexecutor.hpp"
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Task<T> / Spawn / Schedule / SleepFor / RecvAsync
+//
+// 运行在 IExecutor 上的协程，header-only。协程挂起时不占用任何线程，少量工作线程即可承载
+// 成千上万个并发的逻辑请求。
+//   Task<T>               : 惰性协程，被 co_await 或 Spawn 时才开始执行。co_await 一个 Task 时
+//                           以对称转移直接进入子协程，子协程结束后由完成它的线程直接恢复等待方，
+//                           不经过 Wait，也不阻塞任何线程。子协程抛出的异常在 co_await 处重新抛出。
+//   Spawn(exec, task)     : 把 task 提交到 exec 执行，返回其结果的 Future<T>，供普通代码 Get()
+//                           或 Then()。task 抛出异常、或 options 的令牌已取消 / 截止时间已过
+//                           （此时不执行 task）时 Future 以 kInternalError 完成。
+//   co_await Schedule(exec)        : 让出当前线程，把协程的后续部分重新提交到 exec（也可用于
+//                                    从外部线程切换到执行器）。返回入队结果；入队失败时在当前
+//                                    线程继续执行，与 Future 延续的降级方式一致。
+//   co_await SleepFor(exec, ms)    : 经执行器的时间轮延时后恢复；到期时队列已满则由定时线程直接
+//                                    恢复（timer_caller_runs，带 serial_key 时除外），恢复不会被丢弃。
+//                                    以上两者的 cancel_token / deadline 不交给执行器（被丢弃的
+//                                    恢复任务会让协程永远挂起），而是在恢复时检查：已取消或已
+//                                    过期时照常恢复，返回 kInternalError。
+//   co_await RecvAsync(exec, ch, buf, size, poll_ms)
+//                                  : 等待 IPC 通道可读并接收一条消息。共享内存通道没有就绪通知，
+//                                    无消息时每 poll_ms 毫秒经时间轮重试一次，期间不占用线程。
+//
+// 典型用法：
+//   Task<int> Child(IExecutor* exec) { co_await Schedule(exec); co_return 6; }
+//   Task<int> Parent(IExecutor* exec) { int v = co_await Child(exec); co_return v * 7; }
+//   api::Result<int> r = Spawn(exec, Parent(exec)).Get();  // r.value() == 42
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+struct CoPromiseBase {
+  // 结束时恢复等待方（对称转移，不增加调用栈深度）；无等待方时停在 final_suspend，
+  // 由持有 Task 的一方销毁。
+  struct FinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept {
+      std::coroutine_handle<> next = h.promise().continuation;
+      return next ? next : std::noop_coroutine();
+    }
+    void await_resume() const noexcept {}
+  };
+
+  std::suspend_always initial_suspend() const noexcept { return {}; }
+  FinalAwaiter final_suspend() const noexcept { return {}; }
+  void unhandled_exception() noexcept { error = std::current_exception(); }
+
+  void Rethrow() const {
+    if (error) std::rethrow_exception(error);
+  }
+
+  std::coroutine_handle<> continuation;
+  std::exception_ptr error;
+};
+
+template <typename T>
+struct CoPromise : CoPromiseBase {
+  Task<T> get_return_object() noexcept;
+  template <typename U>
+  void return_value(U&& v) {
+    value = std::forward<U>(v);
+  }
+  T Take() {
+    Rethrow();
+    return std::move(value);
+  }
+  T value{};
+};
+
+template <>
+struct CoPromise<void> : CoPromiseBase {
+  Task<void> get_return_object() noexcept;
+  void return_void() const noexcept {}
+  void Take() const { Rethrow(); }
+};
+
+// Spawn 使用的自毁协程：立即开始执行，结束时自行释放协程帧。
+struct CoDetached {
+  struct promise_type {
+    CoDetached get_return_object() const noexcept { return {}; }
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_never final_suspend() const noexcept { return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() const noexcept { std::terminate(); }
+  };
+};
+
+}  // namespace detail
+
+template <typename T>
+class Task {
+ public:
+  typedef detail::CoPromise<T> promise_type;
+
+  Task() noexcept {}
+  explicit Task(std::coroutine_handle<promise_type> h) noexcept : handle_(h) {}
+  Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+  Task& operator=(Task&& other) noexcept {
+    if (this != &other) {
+      if (handle_) handle_.destroy();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  ~Task() {
+    if (handle_) handle_.destroy();
+  }
+
+  bool valid() const noexcept { return static_cast<bool>(handle_); }
+
+  // co_await：启动子协程并在其结束后恢复等待方，返回结果（或重新抛出异常）。
+  // 同一个 Task 只能被等待一次。
+  auto operator co_await() && noexcept {
+    struct Awaiter {
+      bool await_ready() const noexcept { return !handle || handle.done(); }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle.promise().continuation = awaiting;
+        return handle;
+      }
+      T await_resume() { return handle.promise().Take(); }
+      std::coroutine_handle<promise_type> handle;
+    };
+    return Awaiter{handle_};
+  }
+
+ private:
+  std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> CoPromise<T>::get_return_object() noexcept {
+  return Task<T>(std::coroutine_handle<CoPromise<T> >::from_promise(*this));
+}
+
+inline Task<void> CoPromise<void>::get_return_object() noexcept {
+  return Task<void>(std::coroutine_handle<CoPromise<void> >::from_promise(*this));
+}
+
+}  // namespace detail
+
+// ── 执行器上的可等待对象 ───────────────────────────────────────────────────────
+
+class ScheduleAwaiter {
+ public:
+  ScheduleAwaiter(IExecutor* executor, const TaskSubmitOptions& options)
+      : executor_(executor), options_(options) {}
+
+  bool await_ready() const noexcept { return executor_ == NULL; }
+
+  bool await_suspend(std::coroutine_handle<> h) {
+    // 入队成功后协程可能已在工作线程上恢复甚至结束，此后不能再访问 this；
+    // 恢复任务在 resume 之前写入结果，此时协程仍挂起，awaiter 有效。
+    api::Status st = executor_->SubmitTask(
+        TaskFunction([this, h]() {
+          status_ = detail::FutureStaleStatus(options_.cancel_token, options_.deadline);
+          h.resume();
+        }),
+        detail::FutureSubmitOptions(options_), NULL);
+    if (st.ok()) return true;
+    status_ = st;
+    return false;
+  }
+
+  api::Status await_resume() const { return status_; }
+
+ private:
+  IExecutor* executor_;
+  TaskSubmitOptions options_;
+  api::Status status_;
+};
+
+inline ScheduleAwaiter Schedule(IExecutor* executor,
+                                const TaskSubmitOptions& options = TaskSubmitOptions()) {
+  return ScheduleAwaiter(executor, options);
+}
+
+class SleepAwaiter {
+ public:
+  SleepAwaiter(IExecutor* executor, std::uint32_t delay_ms, const TaskSubmitOptions& options)
+      : executor_(executor), delay_ms_(delay_ms), options_(options) {}
+
+  bool await_ready() const noexcept { return executor_ == NULL || delay_ms_ == 0; }
+
+  bool await_suspend(std::coroutine_handle<> h) {
+    api::Result<TaskId> r = executor_->SubmitAfter(
+        delay_ms_,
+        [this, h]() {
+          status_ = detail::FutureStaleStatus(options_.cancel_token, options_.deadline);
+          h.resume();
+        },
+        TimerOptions(options_));
+    if (r.ok()) return true;
+    status_ = r.status();
+    return false;
+  }
+
+  api::Status await_resume() const { return status_; }
+
+  // 到期时队列已满也不能丢弃恢复回调，否则协程永远挂起：改由定时线程直接恢复。
+  static TaskSubmitOptions TimerOptions(const TaskSubmitOptions& options) {
+    TaskSubmitOptions out = detail::FutureSubmitOptions(options);
+    out.timer_caller_runs = true;
+    return out;
+  }
+
+ private:
+  IExecutor* executor_;
+  std::uint32_t delay_ms_;
+  TaskSubmitOptions options_;
+  api::Status status_;
+};
+
+inline SleepAwaiter SleepFor(IExecutor* executor, std::uint32_t delay_ms,
+                             const TaskSubmitOptions& options = TaskSubmitOptions()) {
+  return SleepAwaiter(executor, delay_ms, options);
+}
+
+class ChannelRecvAwaiter {
+ public:
+  ChannelRecvAwaiter(IExecutor* executor, ipc::IChannel* channel, void* buffer,
+                     std::uint32_t buffer_size, std::uint32_t poll_ms)
+      : executor_(executor),
+        channel_(channel),
+        buffer_(buffer),
+        buffer_size_(buffer_size),
+        poll_ms_(poll_ms == 0 ? 1 : poll_ms),
+        result_(api::Status::Ok()) {}
+
+  bool await_ready() {
+    result_ = channel_->TryRecv(buffer_, buffer_size_);
+    return executor_ == NULL || result_.status().code() != api::StatusCode::kWouldBlock;
+  }
+
+  bool await_suspend(std::coroutine_handle<> h) {
+    api::Status st = Poll(h);
+    if (st.ok()) return true;
+    result_ = api::Result<std::uint32_t>(st);
+    return false;
+  }
+
+  api::Result<std::uint32_t> await_resume() const { return result_; }
+
+ private:
+  // 协程挂起期间 awaiter 位于协程帧内，重试回调可以安全访问 this。
+  api::Status Poll(std::coroutine_handle<> h) {
+    return executor_
+        ->SubmitAfter(
+            poll_ms_,
+            [this, h]() {
+              result_ = channel_->TryRecv(buffer_, buffer_size_);
+              if (result_.status().code() == api::StatusCode::kWouldBlock) {
+                api::Status st = Poll(h);
+                if (st.ok()) return;
+                result_ = api::Result<std::uint32_t>(st);
+              }
+              h.resume();
+            },
+            SleepAwaiter::TimerOptions(TaskSubmitOptions()))
+        .status();
+  }
+
+  IExecutor* executor_;
+  ipc::IChannel* channel_;
+  void* buffer_;
+  std::uint32_t buffer_size_;
+  std::uint32_t poll_ms_;
+  api::Result<std::uint32_t> result_;
+};
+
+// 返回：kOk（value 为消息字节数）或 TryRecv 的其他错误；重试无法入队时返回入队错误。
+inline ChannelRecvAwaiter RecvAsync(IExecutor* executor, ipc::IChannel* channel, void* buffer,
+                                    std::uint32_t buffer_size, std::uint32_t poll_ms = 1) {
+  return ChannelRecvAwaiter(executor, channel, buffer, buffer_size, poll_ms);
+}
+
+// ── Spawn ─────────────────────────────────────────────────────────────────────
+
+namespace detail {
+
+template <typename T>
+CoDetached CoRunSpawned(IExecutor* executor, Task<T> task,
+                        std::shared_ptr<FutureState<T> > state, TaskSubmitOptions options) {
+  co_await Schedule(executor, options);
+  // 已取消或已过期：不执行 task，协程帧（连同 task）随本协程结束一起释放。
+  api::Status stale = FutureStaleStatus(options.cancel_token, options.deadline);
+  if (!stale.ok()) {
+    state->Complete(stale);
+    co_return;
+  }
+  try {
+    if constexpr (std::is_void<T>::value) {
+      co_await std::move(task);
+    } else {
+      state->value = co_await std::move(task);
+    }
+  } catch (...) {
+    state->Complete(FutureError(api::StatusCode::kInternalError, "coroutine threw"));
+    co_return;
+  }
+  state->Complete(api::Status::Ok());
+}
+
+}  // namespace detail
+
+// 在 executor 上启动 task，返回其结果的 Future。executor 为 NULL 或 task 无效时返回
+// 以 kInvalidArgument 完成的 Future。
+template <typename T>
+Future<T> Spawn(IExecutor* executor, Task<T> task,
+                const TaskSubmitOptions& options = TaskSubmitOptions()) {
+  std::shared_ptr<detail::FutureState<T> > state =
+      std::make_shared<detail::FutureState<T> >(executor);
+  if (executor == NULL || !task.valid()) {
+    state->Complete(detail::FutureError(api::StatusCode::kInvalidArgument,
+                                        "executor is null or task is empty"));
+    return Future<T>(state);
+  }
+  detail::CoRunSpawned<T>(executor, std::move(task), state, options);
+  return Future<T>(state);
+}
+
+}  // namespace task
+}  // namespace corekit
+
+#endif  // COREKIT_ENABLE_COROUTINES
@@ -1,32 +1,277 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+
 #include "corekit/task/iexecutor.hpp"
 
 namespace corekit {
 namespace task {
 
 /// Submit a callable (lambda, functor) to an executor.
-/// Convenience wrapper that converts any callable to std::function<void()>.
+/// The callable is stored inline in a TaskFunction (no std::function wrapper), so
+/// fire-and-forget submission of small callables performs no heap allocation in
+/// steady state.
 ///
 /// Usage:
 ///   corekit::task::SubmitLambda(exec, [&]{ process(data); });
 template <typename Fn>
 inline api::Status SubmitLambda(IExecutor* executor, Fn&& fn) {
-  return executor->Submit(std::function<void()>(static_cast<Fn&&>(fn)));
+  return executor->SubmitTask(TaskFunction(static_cast<Fn&&>(fn)), TaskSubmitOptions(), NULL);
 }
 
 /// Submit a callable with options, returning a TaskId.
 template <typename Fn>
 inline api::Result<TaskId> SubmitLambdaEx(IExecutor* executor, Fn&& fn,
                                            const TaskSubmitOptions& options) {
-  return executor->SubmitEx(std::function<void()>(static_cast<Fn&&>(fn)), options);
+  TaskId id = 0;
+  api::Status st = executor->SubmitTask(TaskFunction(static_cast<Fn&&>(fn)), options, &id);
+  if (!st.ok()) return api::Result<TaskId>(st);
+  return api::Result<TaskId>(id);
 }
 
 /// Submit a callable under a serial key.
 template <typename Fn>
 inline api::Result<TaskId> SubmitLambdaWithKey(IExecutor* executor,
                                                 std::uint64_t serial_key, Fn&& fn) {
-  return executor->SubmitWithKey(serial_key, std::function<void()>(static_cast<Fn&&>(fn)));
+  TaskSubmitOptions options;
+  options.serial_key = serial_key;
+  return SubmitLambdaEx(executor, static_cast<Fn&&>(fn), options);
+}
+
+/// Range-based parallel loop: fn(chunk_begin, chunk_end) is called once per chunk.
+/// grain = 0 selects adaptive chunking; the calling thread executes chunks too.
+template <typename Fn>
+inline api::Status ParallelForRange(IExecutor* executor, std::size_t begin, std::size_t end,
+                                    std::size_t grain, Fn&& fn) {
+  return executor->ParallelForRange(begin, end, grain,
+                                    std::function<void(std::size_t, std::size_t)>(
+                                        static_cast<Fn&&>(fn)));
+}
+
+/// Per-index parallel loop built on ParallelForRange: fn(i) is invoked from a tight
+/// loop inside each chunk, so the body can be inlined instead of paying one
+/// std::function call per index.
+///
+/// Usage:
+///   corekit::task::ParallelForEach(exec, 0, n, 0, [&](std::size_t i) { out[i] = f(in[i]); });
+template <typename Fn>
+inline api::Status ParallelForEach(IExecutor* executor, std::size_t begin, std::size_t end,
+                                   std::size_t grain, Fn fn) {
+  return executor->ParallelForRange(
+      begin, end, grain, [fn](std::size_t chunk_begin, std::size_t chunk_end) mutable {
+        for (std::size_t i = chunk_begin; i < chunk_end; ++i) fn(i);
+      });
+}
+
+namespace detail {
+
+/// Number of blocks used by the reduce/scan helpers when grain = 0. The block
+/// layout depends only on the input size and grain, never on the worker count or
+/// on scheduling, which is what makes the combine order deterministic.
+const std::size_t kReduceDefaultBlocks = 256;
+
+inline std::size_t ReduceBlockSize(std::size_t count, std::size_t grain) {
+  if (grain != 0) return grain;
+  const std::size_t size = (count + kReduceDefaultBlocks - 1) / kReduceDefaultBlocks;
+  return size == 0 ? 1 : size;
+}
+
+/// One partial accumulator per block, aligned (and therefore padded) to a cache
+/// line so blocks finishing concurrently on different workers do not write to
+/// the same line.
+template <typename T>
+struct alignas(64) PaddedPartial {
+  explicit PaddedPartial(const T& v) : value(v) {}
+  T value;
+};
+
+/// Fixed-size array of PaddedPartial. std::vector does not honour over-aligned
+/// element types before C++17, so the storage is over-allocated and aligned by
+/// hand to keep every element on its own cache line.
+template <typename T>
+class PartialArray {
+ public:
+  PartialArray(std::size_t count, const T& init)
+      : raw_(new unsigned char[count * sizeof(PaddedPartial<T>) + alignof(PaddedPartial<T>)]),
+        data_(NULL),
+        size_(0) {
+    void* p = raw_;
+    std::size_t space = count * sizeof(PaddedPartial<T>) + alignof(PaddedPartial<T>);
+    data_ = static_cast<PaddedPartial<T>*>(
+        std::align(alignof(PaddedPartial<T>), count * sizeof(PaddedPartial<T>), p, space));
+    try {
+      for (; size_ < count; ++size_) new (data_ + size_) PaddedPartial<T>(init);
+    } catch (...) {
+      Destroy();
+      throw;
+    }
+  }
+
+  ~PartialArray() { Destroy(); }
+
+  PaddedPartial<T>& operator[](std::size_t i) { return data_[i]; }
+
+ private:
+  PartialArray(const PartialArray&);
+  PartialArray& operator=(const PartialArray&);
+
+  void Destroy() {
+    while (size_ > 0) data_[--size_].~PaddedPartial<T>();
+    delete[] raw_;
+  }
+
+  unsigned char* raw_;
+  PaddedPartial<T>* data_;
+  std::size_t size_;
+};
+
+/// Fold block [b, e) of a transformed sequence, seeded with its first element
+/// (so no identity element is required).
+template <typename It, typename T, typename ReduceOp, typename TransformOp>
+inline T FoldBlock(It first, std::size_t b, std::size_t e, ReduceOp& reduce_op,
+                   TransformOp& transform_op) {
+  It it = first + static_cast<typename std::iterator_traits<It>::difference_type>(b);
+  T acc = transform_op(*it);
+  for (std::size_t i = b + 1; i < e; ++i) {
+    ++it;
+    acc = reduce_op(acc, transform_op(*it));
+  }
+  return acc;
+}
+
+/// Status returned when a user operation throws outside the executor's own
+/// exception handling (the serial combine/prefix steps run on the caller).
+inline api::Status ReduceOpError() {
+  return api::Status::FromModule(api::StatusCode::kInternalError,
+                                 "reduce/scan operation threw an exception",
+                                 api::ErrorModule::kTask);
+}
+
+struct IdentityTransform {
+  template <typename U>
+  const U& operator()(const U& v) const {
+    return v;
+  }
+};
+
+}  // namespace detail
+
+/// Parallel transform-reduce over [first, last) (random-access iterators):
+///   result = reduce_op(...reduce_op(init, transform_op(x0))..., transform_op(xn-1))
+/// The range is cut into fixed blocks (grain elements each, or 256 blocks when
+/// grain = 0); each block is folded on the executor into its own padded partial,
+/// and partials are combined with init strictly in block order. reduce_op must be
+/// associative; it need not be commutative, and results are reproducible run to
+/// run, independent of the worker count (floating-point sums included).
+/// Returns kInternalError if an operation throws.
+///
+/// Usage:
+///   auto r = corekit::task::ParallelTransformReduce(exec, v.begin(), v.end(), 0.0,
+///                                                   std::plus<double>(),
+///                                                   [](double x) { return x * x; });
+template <typename It, typename T, typename ReduceOp, typename TransformOp>
+inline api::Result<T> ParallelTransformReduce(IExecutor* executor, It first, It last, T init,
+                                              ReduceOp reduce_op, TransformOp transform_op,
+                                              std::size_t grain = 0) {
+  const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+  if (count == 0) return api::Result<T>(init);
+  const std::size_t block = detail::ReduceBlockSize(count, grain);
+  const std::size_t blocks = (count + block - 1) / block;
+
+  detail::PartialArray<T> partials(blocks, init);
+  api::Status st = executor->ParallelForRange(
+      0, blocks, 1,
+      [&](std::size_t block_begin, std::size_t block_end) {
+        for (std::size_t k = block_begin; k < block_end; ++k) {
+          const std::size_t e = (k + 1) * block < count ? (k + 1) * block : count;
+          partials[k].value =
+              detail::FoldBlock<It, T>(first, k * block, e, reduce_op, transform_op);
+        }
+      });
+  if (!st.ok()) return api::Result<T>(st);
+
+  T result = init;
+  try {
+    for (std::size_t k = 0; k < blocks; ++k) result = reduce_op(result, partials[k].value);
+  } catch (...) {
+    return api::Result<T>(detail::ReduceOpError());
+  }
+  return api::Result<T>(result);
+}
+
+/// Parallel reduce over [first, last); see ParallelTransformReduce for the
+/// blocking and determinism guarantees.
+///
+/// Usage:
+///   auto sum = corekit::task::ParallelReduce(exec, v.begin(), v.end(), 0LL,
+///                                            std::plus<long long>());
+template <typename It, typename T, typename ReduceOp>
+inline api::Result<T> ParallelReduce(IExecutor* executor, It first, It last, T init,
+                                     ReduceOp reduce_op, std::size_t grain = 0) {
+  return ParallelTransformReduce(executor, first, last, init, reduce_op,
+                                 detail::IdentityTransform(), grain);
+}
+
+/// Parallel inclusive scan: out[i] = x0 op x1 op ... op xi for [first, last),
+/// written to d_first (may alias first). Two passes over the same fixed blocks:
+/// block totals are computed in parallel, prefixed serially in block order, then
+/// each block is rescanned in parallel seeded with its prefix. op must be
+/// associative. Returns kInternalError if op throws.
+///
+/// Usage:
+///   corekit::task::ParallelInclusiveScan(exec, in.begin(), in.end(), out.begin(),
+///                                        std::plus<int>());
+template <typename InIt, typename OutIt, typename Op>
+inline api::Status ParallelInclusiveScan(IExecutor* executor, InIt first, InIt last,
+                                         OutIt d_first, Op op, std::size_t grain = 0) {
+  typedef typename std::iterator_traits<InIt>::value_type T;
+  typedef typename std::iterator_traits<InIt>::difference_type Diff;
+  const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+  if (count == 0) return api::Status::Ok();
+  const std::size_t block = detail::ReduceBlockSize(count, grain);
+  const std::size_t blocks = (count + block - 1) / block;
+
+  detail::PartialArray<T> partials(blocks, T(*first));
+  detail::IdentityTransform identity;
+  if (blocks > 1) {
+    // The last block total never feeds a prefix, so it is not computed.
+    api::Status st = executor->ParallelForRange(
+        0, blocks - 1, 1, [&](std::size_t block_begin, std::size_t block_end) {
+          for (std::size_t k = block_begin; k < block_end; ++k) {
+            partials[k].value = detail::FoldBlock<InIt, T>(first, k * block, (k + 1) * block,
+                                                           op, identity);
+          }
+        });
+    if (!st.ok()) return st;
+    try {
+      for (std::size_t k = 1; k + 1 < blocks; ++k) {
+        partials[k].value = op(partials[k - 1].value, partials[k].value);
+      }
+    } catch (...) {
+      return detail::ReduceOpError();
+    }
+  }
+
+  return executor->ParallelForRange(
+      0, blocks, 1, [&](std::size_t block_begin, std::size_t block_end) {
+        for (std::size_t k = block_begin; k < block_end; ++k) {
+          const std::size_t b = k * block;
+          const std::size_t e = b + block < count ? b + block : count;
+          InIt in = first + static_cast<Diff>(b);
+          OutIt out = d_first + static_cast<Diff>(b);
+          T acc = k == 0 ? T(*in) : op(partials[k - 1].value, *in);
+          *out = acc;
+          for (std::size_t i = b + 1; i < e; ++i) {
+            ++in;
+            ++out;
+            acc = op(acc, *in);
+            *out = acc;
+          }
+        }
+      });
 }
 
 }  // namespace task
@@ -0,0 +1,390 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "corekit/api/status.hpp"
+#include "corekit/task/iexecutor.hpp"
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Future<T> / Async / Then
+//
+// 基于 IExecutor 的轻量异步结果与延续（continuation），header-only。
+//   Async(exec, fn)  : 把 fn 提交到执行器，返回其结果的 Future（T = fn 的返回类型，可为 void）。
+//   f.Then(fn)       : f 就绪后以 f 的值调用 fn（Future<void> 时无参数），返回新的 Future。
+//                      延续由完成前驱的那个线程直接提交到执行器（工作线程上即进入本地队列），
+//                      不经过 Wait，也不占用任何阻塞线程；注册时前驱已就绪则立即提交。
+//   f.Get()          : 阻塞等待并取结果（Future<void> 返回 Status）。
+//
+// 错误模型与 api::Result 一致：fn 抛出异常时 Future 以 kInternalError 完成；
+// 前驱失败时跳过延续，错误原样传递到链尾。延续入队失败（队列满 / 执行器正在关闭）时
+// 在完成前驱的线程上内联执行，保证链条不会中断；内联的延续逐个排队执行，长链不会加深调用栈。
+// options 中的 cancel_token / deadline 在
+// 任务开始时检查：已取消或已过期则不调用 fn，Future 以 kInternalError 完成。
+//
+// 典型用法：
+//   Future<int> f = Async(exec, [] { return 6; });
+//   Future<int> g = f.Then([](const int& v) { return v * 7; });
+//   api::Result<int> r = g.Get();  // r.value() == 42
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <typename T>
+class Future;
+
+namespace detail {
+
+inline api::Status FutureError(api::StatusCode code, const char* message) {
+  return api::Status::FromModule(code, message, api::ErrorModule::kTask);
+}
+
+// Future 内部提交的任务不带 TaskId，执行器丢弃这类任务时无从通知，Future 将永不就绪。
+// 因此 cancel_token 与 deadline 不交给执行器，由任务体在开始时自行检查（见 FutureStaleStatus）。
+inline TaskSubmitOptions FutureSubmitOptions(const TaskSubmitOptions& options) {
+  TaskSubmitOptions out = options;
+  out.cancel_token = CancellationToken();
+  out.deadline = std::chrono::steady_clock::time_point::max();
+  return out;
+}
+
+// 令牌已取消或截止时间已过时返回对应错误，否则返回 kOk。
+inline api::Status FutureStaleStatus(const CancellationToken& token,
+                                     std::chrono::steady_clock::time_point deadline) {
+  if (token.IsCancellationRequested()) {
+    return FutureError(api::StatusCode::kInternalError, "future task canceled");
+  }
+  if (deadline != std::chrono::steady_clock::time_point::max() &&
+      std::chrono::steady_clock::now() >= deadline) {
+    return FutureError(api::StatusCode::kInternalError, "future task deadline expired");
+  }
+  return api::Status::Ok();
+}
+
+// 已注册的延续；前驱就绪后 Run() 恰好被调用一次。
+struct FutureContinuation {
+  virtual ~FutureContinuation() {}
+  virtual void Run() = 0;
+  TaskSubmitOptions options;
+};
+
+struct FutureStateBase {
+  explicit FutureStateBase(IExecutor* exec) : executor(exec), ready(false) {}
+
+  IExecutor* const executor;
+  mutable std::mutex mu;
+  mutable std::condition_variable cv;
+  bool ready;
+  api::Status status;
+  std::vector<std::shared_ptr<FutureContinuation> > continuations;
+
+  // 结果（值已先行写入）就绪：唤醒阻塞的 Get，并提交全部延续。
+  void Complete(const api::Status& st) {
+    std::vector<std::shared_ptr<FutureContinuation> > pending;
+    {
+      std::lock_guard<std::mutex> lock(mu);
+      status = st;
+      ready = true;
+      pending.swap(continuations);
+    }
+    cv.notify_all();
+    for (std::size_t i = 0; i < pending.size(); ++i) Schedule(pending[i], true);
+  }
+
+  void AddContinuation(const std::shared_ptr<FutureContinuation>& cont) {
+    {
+      std::lock_guard<std::mutex> lock(mu);
+      if (!ready) {
+        continuations.push_back(cont);
+        return;
+      }
+    }
+    Schedule(cont, false);
+  }
+
+  // chained = true 表示由前驱完成触发（见 Complete），false 表示注册时前驱已就绪。
+  void Schedule(const std::shared_ptr<FutureContinuation>& cont, bool chained) {
+    std::shared_ptr<FutureContinuation> keep = cont;
+    if (executor != NULL &&
+        executor
+            ->SubmitTask(TaskFunction([keep]() { keep->Run(); }),
+                         FutureSubmitOptions(cont->options), NULL)
+            .ok()) {
+      return;
+    }
+    RunInline(cont, chained);
+  }
+
+  // 提交失败的延续在当前线程执行。长 Then 链上每一环都可能提交失败，逐层直接调用 Run()
+  // 会让栈深度随链长增长，因此按蹦床方式执行：最外层调用者按 FIFO 依次运行，运行期间
+  // 由前驱完成触发的延续只入队、由外层循环接着执行，栈深度保持常数。
+  // 注册时即内联的延续仍立即执行：调用方可能紧接着就等待它的结果，推迟会造成死锁。
+  static void RunInline(const std::shared_ptr<FutureContinuation>& cont, bool chained) {
+    InlineQueue& queue = LocalInlineQueue();
+    if (queue.draining) {
+      if (chained) {
+        queue.pending.push_back(cont);
+      } else {
+        cont->Run();
+      }
+      return;
+    }
+    DrainGuard guard(queue);
+    queue.pending.push_back(cont);
+    while (!queue.pending.empty()) {
+      std::shared_ptr<FutureContinuation> next;
+      next.swap(queue.pending.front());
+      queue.pending.pop_front();
+      next->Run();
+    }
+  }
+
+  struct InlineQueue {
+    InlineQueue() : draining(false) {}
+    std::deque<std::shared_ptr<FutureContinuation> > pending;
+    bool draining;
+  };
+
+  struct DrainGuard {
+    explicit DrainGuard(InlineQueue& q) : queue(q) { queue.draining = true; }
+    ~DrainGuard() { queue.draining = false; }
+    InlineQueue& queue;
+  };
+
+  static InlineQueue& LocalInlineQueue() {
+    static thread_local InlineQueue queue;
+    return queue;
+  }
+
+  bool WaitReady(std::uint32_t timeout_ms) const {
+    std::unique_lock<std::mutex> lock(mu);
+    if (timeout_ms == 0) {
+      cv.wait(lock, [this]() { return ready; });
+      return true;
+    }
+    return cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() { return ready; });
+  }
+};
+
+template <typename T>
+struct FutureState : FutureStateBase {
+  explicit FutureState(IExecutor* exec) : FutureStateBase(exec), value() {}
+  T value;
+};
+
+template <>
+struct FutureState<void> : FutureStateBase {
+  explicit FutureState(IExecutor* exec) : FutureStateBase(exec) {}
+};
+
+// 调用 fn 并把返回值 / 异常写入 state。
+template <typename R>
+struct FutureFulfill {
+  template <typename Call>
+  static void Run(FutureState<R>* state, Call& call) {
+    try {
+      state->value = call();
+    } catch (...) {
+      state->Complete(FutureError(api::StatusCode::kInternalError, "future callable threw"));
+      return;
+    }
+    state->Complete(api::Status::Ok());
+  }
+};
+
+template <>
+struct FutureFulfill<void> {
+  template <typename Call>
+  static void Run(FutureState<void>* state, Call& call) {
+    try {
+      call();
+    } catch (...) {
+      state->Complete(FutureError(api::StatusCode::kInternalError, "future callable threw"));
+      return;
+    }
+    state->Complete(api::Status::Ok());
+  }
+};
+
+// 以前驱的值调用延续函数（前驱为 void 时无参数）。
+template <typename T>
+struct FutureApply {
+  template <typename Fn>
+  static auto Call(Fn& fn, FutureState<T>* prev) -> decltype(fn(prev->value)) {
+    return fn(static_cast<const T&>(prev->value));
+  }
+};
+
+template <>
+struct FutureApply<void> {
+  template <typename Fn>
+  static auto Call(Fn& fn, FutureState<void>*) -> decltype(fn()) {
+    return fn();
+  }
+};
+
+template <typename T, typename Fn>
+struct ThenResult {
+  typedef decltype(std::declval<Fn&>()(std::declval<const T&>())) type;
+};
+
+template <typename Fn>
+struct ThenResult<void, Fn> {
+  typedef decltype(std::declval<Fn&>()()) type;
+};
+
+template <typename T, typename R, typename Fn>
+struct ThenContinuation : FutureContinuation {
+  ThenContinuation(const std::shared_ptr<FutureState<T> >& p,
+                   const std::shared_ptr<FutureState<R> >& n, Fn f)
+      : prev(p), next(n), fn(std::move(f)) {}
+
+  void Run() override {
+    if (!prev->status.ok()) {
+      next->Complete(prev->status);
+      return;
+    }
+    api::Status stale = FutureStaleStatus(options.cancel_token, options.deadline);
+    if (!stale.ok()) {
+      next->Complete(stale);
+      return;
+    }
+    FutureState<T>* p = prev.get();
+    Fn& f = fn;
+    auto call = [&f, p]() { return FutureApply<T>::Call(f, p); };
+    FutureFulfill<R>::Run(next.get(), call);
+  }
+
+  std::shared_ptr<FutureState<T> > prev;
+  std::shared_ptr<FutureState<R> > next;
+  Fn fn;
+};
+
+}  // namespace detail
+
+// Future<T> 与 Future<void> 的公共部分。
+template <typename T>
+class FutureBase {
+ public:
+  // 是否关联了异步结果（默认构造的 Future 无效）。
+  bool valid() const { return state_ != NULL; }
+
+  // 结果是否已就绪（无效 Future 返回 false）。
+  bool IsReady() const {
+    if (!state_) return false;
+    std::lock_guard<std::mutex> lock(state_->mu);
+    return state_->ready;
+  }
+
+  // 等待结果就绪。timeout_ms = 0 表示无限等待。
+  // 返回：kOk = 已就绪；kWouldBlock = 超时；kInvalidArgument = 无效 Future。
+  api::Status Wait(std::uint32_t timeout_ms) const {
+    if (!state_) return detail::FutureError(api::StatusCode::kInvalidArgument, "future is empty");
+    if (!state_->WaitReady(timeout_ms)) {
+      return detail::FutureError(api::StatusCode::kWouldBlock, "future wait timed out");
+    }
+    return api::Status::Ok();
+  }
+
+  // 注册延续：本 Future 成功就绪后，以其值（Future<void> 时无参数）调用 fn，
+  // fn 以 options 提交到创建本 Future 的执行器。返回 fn 结果的 Future。
+  // 本 Future 失败时不调用 fn，返回的 Future 以相同错误完成。同一 Future 可注册多个延续。
+  template <typename Fn>
+  Future<typename detail::ThenResult<T, Fn>::type> Then(
+      Fn fn, const TaskSubmitOptions& options = TaskSubmitOptions()) const {
+    typedef typename detail::ThenResult<T, Fn>::type R;
+    if (!state_) return Future<R>();
+    std::shared_ptr<detail::FutureState<R> > next =
+        std::make_shared<detail::FutureState<R> >(state_->executor);
+    std::shared_ptr<detail::ThenContinuation<T, R, Fn> > cont =
+        std::make_shared<detail::ThenContinuation<T, R, Fn> >(state_, next, std::move(fn));
+    cont->options = options;
+    state_->AddContinuation(cont);
+    return Future<R>(next);
+  }
+
+ protected:
+  FutureBase() {}
+  explicit FutureBase(const std::shared_ptr<detail::FutureState<T> >& state) : state_(state) {}
+
+  std::shared_ptr<detail::FutureState<T> > state_;
+};
+
+template <typename T>
+class Future : public FutureBase<T> {
+ public:
+  Future() {}
+  // 供 Async / Then 内部构造使用。
+  explicit Future(const std::shared_ptr<detail::FutureState<T> >& state) : FutureBase<T>(state) {}
+
+  // 阻塞等待并返回结果：成功时为值，否则为错误状态。
+  api::Result<T> Get() const {
+    api::Status st = this->Wait(0);
+    if (!st.ok()) return api::Result<T>(st);
+    if (!this->state_->status.ok()) return api::Result<T>(this->state_->status);
+    return api::Result<T>(this->state_->value);
+  }
+};
+
+template <>
+class Future<void> : public FutureBase<void> {
+ public:
+  Future() {}
+  explicit Future(const std::shared_ptr<detail::FutureState<void> >& state)
+      : FutureBase<void>(state) {}
+
+  // 阻塞等待并返回执行结果。
+  api::Status Get() const {
+    api::Status st = Wait(0);
+    if (!st.ok()) return st;
+    return state_->status;
+  }
+};
+
+// 把 fn 提交到 executor 异步执行，返回其结果的 Future。入队失败（队列满 / 执行器正在关闭 /
+// executor 为 NULL）时返回以该错误完成的 Future，不会阻塞。
+template <typename Fn>
+Future<decltype(std::declval<Fn&>()())> Async(
+    IExecutor* executor, Fn fn, const TaskSubmitOptions& options = TaskSubmitOptions()) {
+  typedef decltype(std::declval<Fn&>()()) R;
+  std::shared_ptr<detail::FutureState<R> > state =
+      std::make_shared<detail::FutureState<R> >(executor);
+  if (executor == NULL) {
+    state->Complete(detail::FutureError(api::StatusCode::kInvalidArgument, "executor is null"));
+    return Future<R>(state);
+  }
+  const CancellationToken token = options.cancel_token;
+  const std::chrono::steady_clock::time_point deadline = options.deadline;
+  api::Status st = executor->SubmitTask(
+      TaskFunction([state, fn, token, deadline]() mutable {
+        api::Status stale = detail::FutureStaleStatus(token, deadline);
+        if (!stale.ok()) {
+          state->Complete(stale);
+          return;
+        }
+        detail::FutureFulfill<R>::Run(state.get(), fn);
+      }),
+      detail::FutureSubmitOptions(options), NULL);
+  if (!st.ok()) state->Complete(st);
+  return Future<R>(state);
+}
+
+// 返回一个已就绪的 Future；其延续提交到 executor（NULL 时在注册线程内联执行）。
+template <typename T>
+Future<T> MakeReadyFuture(IExecutor* executor, const T& value) {
+  std::shared_ptr<detail::FutureState<T> > state =
+      std::make_shared<detail::FutureState<T> >(executor);
+  state->value = value;
+  state->Complete(api::Status::Ok());
+  return Future<T>(state);
+}
+
+}  // namespace task
+}  // namespace corekit
@@ -17,14 +17,29 @@ struct GraphTaskOptions {
   const char* name = NULL;
   // 任务调度优先级（通过外部执行器运行时生效）。
   TaskPriority priority = TaskPriority::kNormal;
+  // 预估耗时（微秒），用于关键路径优先调度。0 = 未知：使用以往运行实测耗时的滑动平均，
+  // 尚无实测值时按 1 微秒计。
+  std::uint32_t cost_hint_us = 0;
+};
+
+// 就绪节点的派发顺序。
+enum class GraphSchedule : std::uint8_t {
+  // 按就绪先后派发。
+  kFifo = 0,
+  // 按上行秩（节点到任一汇点的最长加权路径）从大到小派发，优先推进关键路径，
+  // 异构 DAG 上可缩短总耗时。
+  kCriticalPath = 1
 };
 
 // RunWithExecutor 的运行控制选项。
 struct GraphRunOptions {
-  // true：任意节点失败后立即停止提交新任务（已在运行的继续执行）。
+  // true：任意节点失败后不再启动新节点（已在运行的继续执行，未开始的计入 canceled）。
   bool fail_fast = true;
-  // 单批最大并发节点数。0 = 不限制（同一层级的节点全部并发）。
+  // 同时在途（已提交或正在执行）的最大节点数，超出的就绪节点按 schedule 排队。
+  // 0 = kFifo 下不限制（节点一旦就绪立即提交）；kCriticalPath 下取执行器当前工作线程数
+  // （弹性执行器取 max_workers，以便积压时仍能扩容），使派发顺序由图而非执行器队列决定。
   std::uint32_t max_concurrency = 0;
+  GraphSchedule schedule = GraphSchedule::kCriticalPath;
 };
 
 // 每次运行的统计快照。
@@ -33,6 +48,33 @@ struct GraphRunStats {
   std::uint64_t succeeded = 0;
   std::uint64_t failed = 0;
   std::uint64_t canceled = 0;
+  // 因条件节点未选中其所在分支而跳过的节点数（不计入 canceled）。
+  std::uint64_t skipped = 0;
+};
+
+class ITaskGraph;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ISubflow
+//
+// 动态节点（AddDynamicTask）在运行期派生子工作的句柄，仅在节点函数执行期间有效。
+// 派生的子任务 / 子图全部结束后，该节点才算完成并解锁其后继；任一子工作失败
+// 则该节点按失败计。子工作不计入 GraphRunStats，也不占用 max_concurrency 额度。
+// 同步 Run() 中子工作在调用时直接执行。
+// ─────────────────────────────────────────────────────────────────────────────
+class ISubflow {
+ public:
+  // 派生一个子任务，与节点函数的剩余部分及其他子任务并发执行。
+  // 返回：kOk；kInvalidArgument = fn 为空；提交失败时返回执行器错误，并且节点按失败计。
+  virtual api::Status Spawn(std::function<void()> fn) = 0;
+
+  // 把一张已编译（Compile）的图作为子工作运行，复用其编译结果，不重新校验或建图。
+  // 同一张图可被多个动态节点同时派生；运行期间不能修改该图。
+  // 返回：kOk；kInvalidArgument = graph 为空、未编译或不是本实现创建的图。
+  virtual api::Status SpawnGraph(ITaskGraph* graph) = 0;
+
+ protected:
+  virtual ~ISubflow() {}
 };
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -48,6 +90,7 @@ struct GraphRunStats {
 //   g->AddDependency(a, c);   // a 先于 c
 //   g->AddDependency(b, c);   // b 先于 c（a 与 b 并行）
 //   g->Validate();
+//   g->Compile();             // 可选：提前校验并冻结，重复运行同一张图时只重置计数
 //
 //   // 同步单线程运行（无需外部执行器）：
 //   g->Run();
@@ -56,6 +99,9 @@ struct GraphRunStats {
 //   g->RunWithExecutor(exec, {}).value();
 //
 //   g->Release();
+//
+// 线程安全：图的构建与运行须在同一线程（或由调用方同步）；同一张图不能并发运行，
+// 运行期间不能修改图结构。
 // ─────────────────────────────────────────────────────────────────────────────
 class ITaskGraph {
  public:
@@ -97,10 +143,40 @@ class ITaskGraph {
   virtual api::Result<GraphRunStats> Run() = 0;
 
   // 使用外部执行器并行运行任务图，支持 fail_fast 和并发度控制。
+  // 按数据流调度：节点的全部前驱完成后立即提交，不等待同层其他节点，
+  // 总耗时取决于最长依赖链而非各层最慢节点之和。调用线程阻塞到全部节点结束。
   // executor 不允许为 nullptr；请使用 Run() 进行同步执行。
-  // 返回：GraphRunStats 包含执行统计。
+  // 返回：GraphRunStats 包含执行统计；节点提交失败时返回该错误（已提交的节点仍会等待结束）。
   virtual api::Result<GraphRunStats> RunWithExecutor(IExecutor* executor,
                                                      const GraphRunOptions& options) = 0;
+
+  // ── 扩展接口 ──────────────────────────────────────────────────────────────
+  // 以下方法晚于上面的接口加入，追加在末尾以保持已有方法的 vtable 槽位不变。
+
+  // 校验并把图冻结为连续数组（展开子图后的节点表、CSR 邻接表、初始入度）。编译后的图重复运行时
+  // 跳过校验与建图，只重置计数。AddTask / AddDependency / Clear 会使编译结果失效，
+  // 下次运行时自动重新编译；未显式调用 Compile 时首次运行也会自动编译。
+  // 返回：kOk；kInvalidArgument = 图中存在环。
+  virtual api::Status Compile() = 0;
+
+  // 新增条件节点：fn 返回要执行的后继序号（按 AddDependency 添加该节点后继的先后顺序，
+  // 从 0 开始），其余后继不被激活。节点只要有一条入边被激活就会执行；所有入边都未被
+  // 激活的节点连同只经由它可达的子树一并跳过（计入 skipped）。返回值越界时不激活任何后继；
+  // fn 抛出异常时按失败计，且不激活任何后继。
+  virtual api::Result<TaskId> AddConditionTask(
+      std::function<std::uint32_t()> fn, const GraphTaskOptions& options = GraphTaskOptions()) = 0;
+
+  // 新增动态节点：fn 通过 ISubflow 在运行期派生子任务或子图（见 ISubflow）。
+  virtual api::Result<TaskId> AddDynamicTask(
+      std::function<void(ISubflow&)> fn, const GraphTaskOptions& options = GraphTaskOptions()) = 0;
+
+  // 把另一张图作为单个节点嵌入：编译时展开到本图中，依赖它的节点在子图全部节点结束后执行。
+  // 子图在本图的生命周期内须保持有效；之后修改子图会使本图在下次运行时重新编译。
+  // 子图节点计入本图的 GraphRunStats。
+  // 返回：kInvalidArgument = graph 为空、为本图自身或不是本实现创建的图。
+  // 相互嵌入形成的环在 Validate / Compile 时报 kInvalidArgument。
+  virtual api::Result<TaskId> AddSubgraph(ITaskGraph* graph,
+                                          const GraphTaskOptions& options = GraphTaskOptions()) = 0;
 };
 
 }  // namespace task
@@ -1,15 +1,21 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "corekit/api/status.hpp"
 #include "corekit/api/version.hpp"
+#include "corekit/task/cancellation.hpp"
+#include "corekit/task/task_function.hpp"
 
 namespace corekit {
 namespace task {
 
+// 任务 ID：内部编码 "状态槽位 + 代数"，对调用方不透明，0 永远无效。
+// 已完成任务的状态仅在有限窗口内保留，过期或伪造的 ID 查询返回 kNotFound。
 typedef std::uint64_t TaskId;
 
 enum class TaskPriority : std::uint8_t {
@@ -25,13 +31,109 @@ enum class ExecutorPolicy : std::uint8_t {
   kHybridFairPriority = 3
 };
 
+// 调度后端。
+//   kSharedQueue  : 所有工作线程共享一个全局队列（默认，严格遵循 policy 顺序）。
+//   kWorkStealing : 每个工作线程拥有本地 Chase-Lev 双端队列，空闲时随机窃取；
+//                   工作线程内提交的任务进入本地队列（不参与优先级排序）。
+//                   外部线程提交的任务：kFifo / kFair 下经共享队列按 policy 排序；
+//                   kPriority / kHybridFairPriority 下进入按优先级分道的无锁注入队列，
+//                   按严格优先级取出，以每 16 次取一次低优先级通道代替 aging_threshold 老化。
+//                   kDropOldestLowPriority 过载策略下始终经共享队列（以便挤出）。
+enum class ExecutorBackend : std::uint8_t {
+  kSharedQueue = 0,
+  kWorkStealing = 1
+};
+
+// 工作线程 CPU 绑定策略（仅 Linux 生效，其他平台忽略绑定但保留节点队列）。
+//   kNone    : 不逐线程绑定；指定了 cpus 时所有线程绑定到该集合。
+//   kCompact : 按 (节点, CPU) 顺序逐个绑定单个 CPU，先填满一个节点再用下一个。
+//   kScatter : 线程轮流分布到各节点，每个线程绑定一个 CPU。
+//   kPerNode : 按节点划分子池：线程轮流分配到各节点，绑定到该节点的全部 CPU。
+// kNone 以外的策略为每个节点维护本地就绪队列，配合 TaskSubmitOptions::numa_node 使用。
+enum class AffinityPolicy : std::uint8_t {
+  kNone = 0,
+  kCompact = 1,
+  kScatter = 2,
+  kPerNode = 3
+};
+
+// 工作线程空闲时的等待策略。
+//   kBlocking     : 无任务时立即在条件变量上休眠（默认，空闲时不占 CPU）。
+//   kSpinThenPark : 先自旋 spin_count 轮、再让出时间片 yield_count 次，仍无任务才休眠；
+//                   自旋期间到达的任务无需唤醒系统调用即可被取走，适合延迟敏感的请求路径。
+//   kBusyPoll     : 始终轮询、从不休眠，适合独占 CPU 核心的部署；空闲时持续占满 CPU，
+//                   且不会因 idle_timeout_ms 退出。
+enum class WaitStrategy : std::uint8_t {
+  kBlocking = 0,
+  kSpinThenPark = 1,
+  kBusyPoll = 2
+};
+
+// 队列满（或触发限速）时的提交策略。
+//   kReject                : 立即返回 kWouldBlock（默认）。
+//   kBlock                 : 提交线程等待空位（或令牌），最长 block_timeout_ms，超时返回 kWouldBlock。
+//                            在工作线程内提交时不等待（避免线程池自锁），按 kReject 处理。
+//   kCallerRuns            : 在提交线程上直接执行该任务，天然降低生产速度。
+//                            带 serial_key 的任务不能越过键队列，按 kReject 处理。
+//   kDropOldestLowPriority : 从共享就绪队列中挤出优先级不高于新任务的最老任务（先挑低优先级），
+//                            被挤出的任务按取消处理；无可挤出的任务时按 kReject 处理。
+//                            只挤出带 TaskId 的任务：SubmitTask 未请求 id 的任务没有途径得知
+//                            被丢弃，始终保留。
+enum class OverflowPolicy : std::uint8_t {
+  kReject = 0,
+  kBlock = 1,
+  kCallerRuns = 2,
+  kDropOldestLowPriority = 3
+};
+
 struct ExecutorOptions {
-  // 工作线程数。0 = 自动（等于硬件并发数）。
+  // 工作线程数。0 = 自动（创建时等于硬件并发数；Reconfigure 时保持当前线程数）。
   std::size_t worker_count = 0;
   // 队列容量上限。0 = 无限制。
   std::size_t queue_capacity = 0;
   // 调度策略，默认为混合公平优先级策略。
   ExecutorPolicy policy = ExecutorPolicy::kHybridFairPriority;
+  // 老化阈值（仅 kHybridFairPriority）：排队任务每被越过 aging_threshold 次调度，
+  // 有效优先级提升一级（最高到 kHigh），防止低优先级任务饿死。0 = 不老化（等价 kPriority）。
+  std::uint32_t aging_threshold = 64;
+  // 调度后端，仅在创建时生效（Reconfigure 不切换后端）。
+  ExecutorBackend backend = ExecutorBackend::kSharedQueue;
+
+  // ── 弹性伸缩（max_workers > 0 时启用）────────────────────────────────────
+  // 启用后工作线程数在 [min_workers, max_workers] 内随负载变化，初始为 worker_count
+  // （截断到该区间）；max_workers = 0 为固定线程池，线程数恒为 worker_count。
+  std::size_t min_workers = 0;
+  std::size_t max_workers = 0;
+  // 空闲超过该时长且线程数 > min_workers 时线程退出。0 = 不因空闲退出。
+  std::uint32_t idle_timeout_ms = 0;
+  // 排队任务数超过该值且没有空闲线程时新增线程（不超过 max_workers）。
+  std::size_t spawn_queue_depth = 0;
+
+  // ── CPU 亲和性 / NUMA（仅在创建时生效）──────────────────────────────────────
+  AffinityPolicy affinity = AffinityPolicy::kNone;
+  // 允许使用的 CPU 编号列表，由调用方持有，创建时复制。NULL / 0 = 进程允许的全部 CPU。
+  const std::uint32_t* cpus = NULL;
+  std::size_t cpu_count = 0;
+
+  // ── 空闲等待策略（Reconfigure 可调整）────────────────────────────────────────
+  WaitStrategy wait_strategy = WaitStrategy::kBlocking;
+  // kSpinThenPark 下休眠前的 CPU 暂停（pause）次数与让出时间片（yield）次数。
+  std::uint32_t spin_count = 2048;
+  std::uint32_t yield_count = 16;
+
+  // 记录任务排队 / 执行耗时直方图与各工作线程忙闲时间（见 QueryLatency）。
+  // 默认关闭；开启后每个任务增加三次时钟读取。Reconfigure 可随时开关。
+  bool enable_latency_stats = false;
+
+  // ── 过载与限速（Reconfigure 可调整）─────────────────────────────────────────
+  OverflowPolicy overflow_policy = OverflowPolicy::kReject;
+  // kBlock 下提交线程最长等待时间（毫秒）。0 = 无限等待（执行器关闭时返回）。
+  std::uint32_t block_timeout_ms = 0;
+  // 按优先级（下标为 TaskPriority 的数值）的令牌桶限速：每秒最多提交 rate_limit_per_sec 个任务，
+  // 允许 rate_burst 个突发（0 视为 1）。rate_limit_per_sec = 0 表示该优先级不限速。
+  // 超出速率的提交与队列满同样按 overflow_policy 处理（kDropOldestLowPriority 下直接拒绝）。
+  std::uint32_t rate_limit_per_sec[3] = {0, 0, 0};
+  std::uint32_t rate_burst[3] = {0, 0, 0};
 };
 
 struct TaskSubmitOptions {
@@ -39,6 +141,21 @@ struct TaskSubmitOptions {
   TaskPriority priority = TaskPriority::kNormal;
   // 串行键：同一键值的任务不会并发执行。0 表示无限制。
   std::uint64_t serial_key = 0;
+  // NUMA 节点提示（可用节点的序号，从 0 开始）。affinity != kNone 时任务进入该节点的
+  // 本地队列，优先由该节点上的线程执行（其他节点空闲时仍可取走）。-1 或越界 = 不指定。
+  std::int32_t numa_node = -1;
+  // 截止时间：出队时已过期的任务不再执行，按取消处理并计入 ExecutorStats::expired。
+  // 默认 time_point::max() 表示不设截止时间。
+  std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+  // 协作式取消令牌（见 cancellation.hpp）：出队时已取消的任务不执行，计入 canceled；
+  // 运行中的任务需自行轮询令牌。
+  // 截止时间与令牌造成的丢弃只能经 TaskId 观察到；未分配 id 的任务被丢弃时不通知任何人，
+  // 依赖任务必定执行的提交方不应把这两项交给执行器。
+  CancellationToken cancel_token;
+  // 仅对 SubmitAfter 生效：到期时无法入队（队列已满 / 执行器正在关闭）时，在定时线程上直接
+  // 执行 fn（计入 caller_runs），而不是按取消处理。用于协程恢复这类一旦丢弃提交方就永远
+  // 等不到结果的回调。fn 应尽快返回，否则会推迟其他定时任务；带 serial_key 的任务不适用。
+  bool timer_caller_runs = false;
 };
 
 struct ExecutorStats {
@@ -46,10 +163,49 @@ struct ExecutorStats {
   std::uint64_t completed = 0;
   std::uint64_t failed = 0;
   std::uint64_t canceled = 0;
+  // 因截止时间已过而在出队时丢弃的任务数。
+  std::uint64_t expired = 0;
   std::uint64_t rejected = 0;
+  // 被 kDropOldestLowPriority 挤出队列的任务数。
+  std::uint64_t dropped = 0;
+  // 因队列满或限速而在提交线程上直接执行的任务数（kCallerRuns）。
+  std::uint64_t caller_runs = 0;
+  // 触发限速的提交次数（无论最终等待、内联执行还是被拒绝）。
+  std::uint64_t throttled = 0;
+  // 被其他工作线程窃取执行的任务数（仅 kWorkStealing 后端）。
   std::uint64_t stolen = 0;
   std::size_t queue_depth = 0;
   std::size_t queue_high_watermark = 0;
+  // 当前存活的工作线程数。
+  std::size_t worker_count = 0;
+  // 弹性伸缩的线程数上限（ExecutorOptions::max_workers）；0 = 固定线程池。
+  std::size_t max_workers = 0;
+};
+
+// 一组耗时样本的摘要（纳秒）。分位数来自对数-线性直方图，相对误差约 6%。
+struct LatencySummary {
+  std::uint64_t count = 0;
+  std::uint64_t mean_ns = 0;
+  std::uint64_t p50_ns = 0;
+  std::uint64_t p99_ns = 0;
+  std::uint64_t p999_ns = 0;
+  std::uint64_t max_ns = 0;
+};
+
+// 单个工作线程槽位的忙闲统计。idle_ns 为线程存活时间中未执行任务的部分。
+struct WorkerTimeStats {
+  std::uint64_t tasks = 0;
+  std::uint64_t busy_ns = 0;
+  std::uint64_t idle_ns = 0;
+};
+
+struct ExecutorLatencyStats {
+  // 提交（或定时任务到期）→ 开始执行；串行键任务包含在键队列中等待的时间。
+  LatencySummary queue_wait;
+  // 开始执行 → 执行结束。
+  LatencySummary run;
+  // 按工作线程槽位排列；槽位在线程退出后保留并被新线程复用。
+  std::vector<WorkerTimeStats> workers;
 };
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -83,8 +239,8 @@ class IExecutor {
   // ── 提交接口（主要 C++ API，接受 lambda / std::function）─────────────────
 
   // 提交一个无需跟踪的即发任务。
-  // 返回：kOk = 已入队；kWouldBlock = 队列已满；kInternalError = 执行器正在关闭。
-  // 线程安全。
+  // 返回：kOk = 已入队（或按 kCallerRuns 已执行完）；kWouldBlock = 队列已满或超出限速，
+  // 且 overflow_policy 未能接纳；kInternalError = 执行器正在关闭。线程安全。
   virtual api::Status Submit(std::function<void()> fn) = 0;
 
   // 提交任务并返回 TaskId，可用于 Wait / TryCancel。
@@ -97,8 +253,8 @@ class IExecutor {
   virtual api::Result<TaskId> SubmitWithKey(std::uint64_t serial_key,
                                             std::function<void()> fn) = 0;
 
-  // 并行处理范围 [begin, end)，每批最多 grain 个元素。
-  // grain = 0 自动调整为 1；grain 越小并行度越高但调度开销也越高。
+  // 并行处理范围 [begin, end)，对每个下标调用 fn(i)。
+  // grain > 0：每批最多 grain 个元素；grain = 0：按剩余量自适应分块（见 ParallelForRange）。
   // 调用会阻塞直到所有 chunk 完成。线程安全。
   virtual api::Status ParallelFor(std::size_t begin, std::size_t end, std::size_t grain,
                                   std::function<void(std::size_t)> fn) = 0;
@@ -134,9 +290,61 @@ class IExecutor {
   // 获取执行器运行时统计信息。
   virtual api::Result<ExecutorStats> QueryStats() const = 0;
 
-  // 运行时调整调度参数（仅 queue_capacity 和 policy 生效，worker_count 不做运行时变更）。
+  // 运行时调整参数：queue_capacity、policy、aging_threshold、worker_count、弹性伸缩参数
+  // 及空闲等待策略、过载策略与限速均生效（backend 不做运行时变更）。worker_count 增大时立即新增线程；
+  // 减小时多余线程在手头任务完成、且没有可执行任务后退出，不会打断正在执行的任务。
+  // worker_count = 0 表示保持当前线程数，其余字段仍按 options 生效（只改部分参数时宜先复制
+  // 当前配置再修改）。
+  // 返回：kOk；kInvalidArgument = min_workers > max_workers。线程安全。
   virtual api::Status Reconfigure(const ExecutorOptions& options) = 0;
 
+  // ── 扩展接口 ──────────────────────────────────────────────────────────────
+  // 以下方法晚于上面的接口加入。新增虚函数一律追加在末尾，已有方法的 vtable 槽位保持不变。
+
+  // 零分配提交路径：可调用对象存放在 TaskFunction 的内联缓冲区中，执行器将其移入
+  // 池化的任务槽，不再额外包装。out_id 为 NULL 时为即发任务（不分配 TaskId 和状态记录，
+  // 稳态下无堆分配）；非 NULL 时写入 TaskId，可用于 Wait / TryCancel。
+  // 返回值同 Submit；失败时 fn 已被消费。线程安全。
+  virtual api::Status SubmitTask(TaskFunction&& fn, const TaskSubmitOptions& options,
+                                 TaskId* out_id) = 0;
+
+  // 按子区间并行处理 [begin, end)：fn(chunk_begin, chunk_end) 每个分块调用一次，
+  // 循环体在 fn 内部展开，避免逐下标的间接调用。
+  // grain > 0：固定分块，每块最多 grain 个元素；
+  // grain = 0：自适应分块，块大小随剩余量递减（剩余量 / (2 × 参与线程数)），兼顾负载均衡与调度开销。
+  // 调用线程本身也参与执行分块（在工作线程中嵌套调用不会死锁），全部分块完成后返回。
+  // 返回：kOk；kInvalidArgument = 参数非法；kInternalError = 某个分块抛出异常。线程安全。
+  virtual api::Status ParallelForRange(std::size_t begin, std::size_t end, std::size_t grain,
+                                       std::function<void(std::size_t, std::size_t)> fn) = 0;
+
+  // 批量提交 count 个任务（共用同一组 options），整批在一次入队临界区内完成，
+  // 并一次性唤醒 min(count, 空闲线程数) 个工作线程，避免逐个提交时的锁竞争与唤醒风暴。
+  // out_ids 为 NULL 表示即发；否则须至少容纳 count 个元素，按 fns 顺序写入 TaskId。
+  // 全有或全无：任一 fn 为空返回 kInvalidArgument，容量不足（且 overflow_policy 未能接纳）
+  // 返回 kWouldBlock，均不入队任何任务（此时 fns 不被消费）；成功或执行器正在关闭
+  // （kInternalError）时 fns 中的对象均已被移走。kCallerRuns 下整批在提交线程上按序执行。
+  // serial_key != 0 时整批按顺序挂入同一串行键队列。线程安全。
+  virtual api::Status SubmitBatch(TaskFunction* fns, std::size_t count,
+                                  const TaskSubmitOptions& options, TaskId* out_ids) = 0;
+
+  // 延时提交：delay_ms 毫秒后按 options 将 fn 入队（delay_ms = 0 时立即入队）。
+  // 返回的 TaskId 与 SubmitEx 相同，可用于 Wait / TryCancel；到期前 TryCancel 立即生效。
+  // 定时由执行器内部的单个时间轮线程驱动（首次使用时创建，精度 1 ms，只会推迟不会提前）。
+  // 到期时队列已满或执行器正在关闭则按取消处理（options.timer_caller_runs 时改为在定时线程上执行）。WaitAll 不等待尚未到期的任务，
+  // 销毁执行器时未到期的任务被取消。线程安全。
+  virtual api::Result<TaskId> SubmitAfter(std::uint32_t delay_ms, std::function<void()> fn,
+                                          const TaskSubmitOptions& options) = 0;
+
+  // 周期提交：按固定频率每 period_ms 毫秒将 fn 入队执行一次（首次在 period_ms 之后），
+  // 直到对返回的 TaskId 调用 TryCancel；Wait 在取消后返回，已开始的一轮不会被打断。
+  // 上一轮尚未执行完时跳过本轮，不会堆积；某一轮抛出异常计入 failed，不影响后续轮次。
+  // 返回：kInvalidArgument = period_ms 为 0 或 fn 为空。线程安全。
+  virtual api::Result<TaskId> SubmitEvery(std::uint32_t period_ms, std::function<void()> fn,
+                                          const TaskSubmitOptions& options) = 0;
+
+  // 获取耗时分布与各工作线程忙闲时间（需 ExecutorOptions::enable_latency_stats）。
+  // 未开启时各项为 0。数据自开启起累计，读取无锁、与工作线程并发时为近似快照。
+  virtual api::Result<ExecutorLatencyStats> QueryLatency() const = 0;
 };
 
 }  // namespace task
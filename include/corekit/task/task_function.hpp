@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TaskFunction
+//
+// 仅可移动的 void() 可调用对象包装，带 kInlineSize 字节的内联缓冲区（small-buffer）。
+// 可调用对象不超过 kInlineSize、对齐不超过 kInlineAlign 且可 noexcept 移动时直接存入
+// 内联缓冲区，构造/移动/销毁均不触发堆分配；否则退化为一次堆分配。
+//
+// 与 std::function 的区别：
+//   - 不要求可调用对象可拷贝（可捕获 unique_ptr 等仅可移动类型）；
+//   - 内联容量更大（std::function 通常仅 16 字节）。
+//
+// 典型用法：
+//   TaskFunction fn([&counter] { ++counter; });
+//   exec->SubmitTask(std::move(fn), TaskSubmitOptions(), NULL);
+// ─────────────────────────────────────────────────────────────────────────────
+class TaskFunction {
+ public:
+  static const std::size_t kInlineSize = 48;
+  static const std::size_t kInlineAlign = alignof(std::max_align_t);
+
+  TaskFunction() : ops_(NULL) {}
+  TaskFunction(std::nullptr_t) : ops_(NULL) {}
+
+  template <typename Fn,
+            typename = typename std::enable_if<
+                !std::is_same<typename std::decay<Fn>::type, TaskFunction>::value>::type>
+  TaskFunction(Fn&& fn) : ops_(NULL) {
+    typedef typename std::decay<Fn>::type F;
+    if (IsNullCallable(fn)) return;
+    Construct<F>(std::forward<Fn>(fn), std::integral_constant<bool, FitsInline<F>::value>());
+  }
+
+  TaskFunction(TaskFunction&& other) noexcept : ops_(NULL) { MoveFrom(other); }
+
+  TaskFunction& operator=(TaskFunction&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  TaskFunction& operator=(std::nullptr_t) {
+    Reset();
+    return *this;
+  }
+
+  TaskFunction(const TaskFunction&) = delete;
+  TaskFunction& operator=(const TaskFunction&) = delete;
+
+  ~TaskFunction() { Reset(); }
+
+  explicit operator bool() const { return ops_ != NULL; }
+
+  // 调用被包装的对象。对空 TaskFunction 调用将抛出 std::bad_function_call。
+  void operator()() {
+    if (ops_ == NULL) throw std::bad_function_call();
+    ops_->invoke(&storage_);
+  }
+
+  // 销毁被包装的对象，变为空。
+  void Reset() {
+    if (ops_ != NULL) {
+      ops_->destroy(&storage_);
+      ops_ = NULL;
+    }
+  }
+
+  // 被包装的对象是否存放在内联缓冲区中（用于诊断/测试）。
+  bool IsInline() const { return ops_ != NULL && ops_->is_inline; }
+
+  // 类型 F 能否内联存放。
+  template <typename F>
+  struct FitsInline
+      : std::integral_constant<bool, sizeof(F) <= kInlineSize && alignof(F) <= kInlineAlign &&
+                                         std::is_nothrow_move_constructible<F>::value> {};
+
+ private:
+  struct Ops {
+    void (*invoke)(void* storage);
+    void (*move)(void* dst, void* src);  // 移动到 dst 并销毁 src
+    void (*destroy)(void* storage);
+    bool is_inline;
+  };
+
+  template <typename F>
+  struct InlineOps {
+    static F* Get(void* storage) { return static_cast<F*>(storage); }
+    static void Invoke(void* storage) { (*Get(storage))(); }
+    static void Move(void* dst, void* src) {
+      ::new (dst) F(std::move(*Get(src)));
+      Get(src)->~F();
+    }
+    static void Destroy(void* storage) { Get(storage)->~F(); }
+    static const Ops* Table() {
+      static const Ops ops = {&Invoke, &Move, &Destroy, true};
+      return &ops;
+    }
+  };
+
+  template <typename F>
+  struct HeapOps {
+    static F*& Get(void* storage) { return *static_cast<F**>(storage); }
+    static void Invoke(void* storage) { (*Get(storage))(); }
+    static void Move(void* dst, void* src) {
+      ::new (dst) F*(Get(src));
+      Get(src) = NULL;
+    }
+    static void Destroy(void* storage) { delete Get(storage); }
+    static const Ops* Table() {
+      static const Ops ops = {&Invoke, &Move, &Destroy, false};
+      return &ops;
+    }
+  };
+
+  template <typename F, typename Fn>
+  void Construct(Fn&& fn, std::true_type /*inline*/) {
+    ::new (static_cast<void*>(&storage_)) F(std::forward<Fn>(fn));
+    ops_ = InlineOps<F>::Table();
+  }
+
+  template <typename F, typename Fn>
+  void Construct(Fn&& fn, std::false_type /*inline*/) {
+    ::new (static_cast<void*>(&storage_)) F*(new F(std::forward<Fn>(fn)));
+    ops_ = HeapOps<F>::Table();
+  }
+
+  void MoveFrom(TaskFunction& other) {
+    if (other.ops_ == NULL) return;
+    other.ops_->move(&storage_, &other.storage_);
+    ops_ = other.ops_;
+    other.ops_ = NULL;
+  }
+
+  template <typename F>
+  static bool IsNullCallable(const F&) { return false; }
+  template <typename R>
+  static bool IsNullCallable(R (*const& fn)()) { return fn == NULL; }
+  template <typename Sig>
+  static bool IsNullCallable(const std::function<Sig>& fn) { return !fn; }
+
+  typename std::aligned_storage<kInlineSize, kInlineAlign>::type storage_;
+  const Ops* ops_;
+};
+
+}  // namespace task
+}  // namespace corekit
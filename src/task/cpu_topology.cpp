@@ -0,0 +1,150 @@
+#include "task/cpu_topology.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace corekit {
+namespace task {
+
+namespace {
+
+bool ParseUint(const std::string& text, std::uint32_t* out) {
+  if (text.empty()) return false;
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    if (text[i] < '0' || text[i] > '9') return false;
+    value = value * 10 + static_cast<std::uint64_t>(text[i] - '0');
+    if (value > 0xFFFFFFFFull) return false;
+  }
+  *out = static_cast<std::uint32_t>(value);
+  return true;
+}
+
+bool ReadFirstLine(const std::string& path, std::string* line) {
+  std::ifstream in(path.c_str());
+  if (!in) return false;
+  std::getline(in, *line);
+  return true;
+}
+
+// 进程当前允许运行的 CPU；无法获取时返回空。
+std::vector<std::uint32_t> ProcessAffinity() {
+  std::vector<std::uint32_t> cpus;
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (std::uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+    }
+  }
+#endif
+  return cpus;
+}
+
+}  // namespace
+
+bool ParseCpuList(const std::string& text, std::vector<std::uint32_t>* out) {
+  out->clear();
+  std::string trimmed;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    if (text[i] != ' ' && text[i] != '\n' && text[i] != '\r' && text[i] != '\t') {
+      trimmed += text[i];
+    }
+  }
+  if (trimmed.empty()) return true;
+
+  std::stringstream ss(trimmed);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    const std::size_t dash = item.find('-');
+    std::uint32_t first = 0;
+    std::uint32_t last = 0;
+    if (dash == std::string::npos) {
+      if (!ParseUint(item, &first)) return false;
+      last = first;
+    } else if (!ParseUint(item.substr(0, dash), &first) ||
+               !ParseUint(item.substr(dash + 1), &last) || last < first) {
+      return false;
+    }
+    for (std::uint32_t cpu = first; cpu <= last; ++cpu) out->push_back(cpu);
+  }
+  std::sort(out->begin(), out->end());
+  out->erase(std::unique(out->begin(), out->end()), out->end());
+  return true;
+}
+
+CpuTopology CpuTopology::Detect() {
+  CpuTopology topo;
+  std::string line;
+  std::vector<std::uint32_t> node_ids;
+  if (ReadFirstLine("/sys/devices/system/node/online", &line) &&
+      ParseCpuList(line, &node_ids)) {
+    for (std::size_t i = 0; i < node_ids.size(); ++i) {
+      std::ostringstream path;
+      path << "/sys/devices/system/node/node" << node_ids[i] << "/cpulist";
+      std::vector<std::uint32_t> cpus;
+      if (ReadFirstLine(path.str(), &line) && ParseCpuList(line, &cpus)) {
+        topo.nodes.push_back(cpus);
+      }
+    }
+  }
+
+  if (topo.CpuCount() == 0) {
+    topo.nodes.clear();
+    std::vector<std::uint32_t> cpus = ProcessAffinity();
+    if (cpus.empty()) {
+      const std::uint32_t hw = std::max(1u, std::thread::hardware_concurrency());
+      for (std::uint32_t cpu = 0; cpu < hw; ++cpu) cpus.push_back(cpu);
+    }
+    topo.nodes.push_back(cpus);
+    return topo;
+  }
+  return topo.Restrict(ProcessAffinity());
+}
+
+CpuTopology CpuTopology::Restrict(const std::vector<std::uint32_t>& allowed) const {
+  if (allowed.empty()) return *this;
+  CpuTopology out;
+  for (std::size_t n = 0; n < nodes.size(); ++n) {
+    std::vector<std::uint32_t> cpus;
+    for (std::size_t i = 0; i < nodes[n].size(); ++i) {
+      if (std::find(allowed.begin(), allowed.end(), nodes[n][i]) != allowed.end()) {
+        cpus.push_back(nodes[n][i]);
+      }
+    }
+    if (!cpus.empty()) out.nodes.push_back(cpus);
+  }
+  return out;
+}
+
+std::size_t CpuTopology::CpuCount() const {
+  std::size_t count = 0;
+  for (std::size_t n = 0; n < nodes.size(); ++n) count += nodes[n].size();
+  return count;
+}
+
+bool PinCurrentThread(const std::vector<std::uint32_t>& cpus) {
+#if defined(__linux__)
+  if (cpus.empty()) return false;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (std::size_t i = 0; i < cpus.size(); ++i) {
+    if (cpus[i] < CPU_SETSIZE) CPU_SET(cpus[i], &set);
+  }
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  (void)cpus;
+  return false;
+#endif
+}
+
+}  // namespace task
+}  // namespace corekit
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// CpuTopology
+//
+// 可用 CPU 按 NUMA 节点分组的视图。Linux 下读取 sysfs
+// （/sys/devices/system/node/nodeN/cpulist），并与进程当前的亲和性掩码求交；
+// 其他平台或 sysfs 不可用时退化为单节点 [0, hardware_concurrency)。
+// 空节点（无可用 CPU）被剔除，nodes 中的下标即节点序号。
+// ─────────────────────────────────────────────────────────────────────────────
+struct CpuTopology {
+  std::vector<std::vector<std::uint32_t> > nodes;
+
+  static CpuTopology Detect();
+
+  // 仅保留 allowed 中的 CPU（allowed 为空时不过滤）；过滤后为空的节点被剔除。
+  CpuTopology Restrict(const std::vector<std::uint32_t>& allowed) const;
+
+  std::size_t CpuCount() const;
+};
+
+// 解析 Linux cpulist 格式（如 "0-3,8,10-11"）。格式错误时返回 false。
+bool ParseCpuList(const std::string& text, std::vector<std::uint32_t>* out);
+
+// 将调用线程绑定到 cpus。非 Linux 平台或 cpus 为空时返回 false（不做任何事）。
+bool PinCurrentThread(const std::vector<std::uint32_t>& cpus);
+
+}  // namespace task
+}  // namespace corekit
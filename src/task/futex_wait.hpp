@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// FutexWait / FutexWake
+//
+// 针对单个 32 位原子字的 "比较后休眠 / 按地址唤醒" 原语：
+//   Linux   : 直接使用 futex(2)（FUTEX_*_PRIVATE），休眠不经过任何用户态锁；
+//   其他平台 : 退化为按地址散列的 mutex + condition_variable 停车表。
+// FutexWait 仅当 *word == expected 时休眠，允许虚假返回，调用方需循环检查条件。
+// FutexWake 只使用地址、不解引用，因此唤醒方在对象可能已被等待方销毁后调用仍是安全的。
+// timeout_ns < 0 表示无限等待。
+// ─────────────────────────────────────────────────────────────────────────────
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+              "futex word must be a plain 32-bit integer");
+
+namespace futex_detail {
+
+struct ParkingBucket {
+  std::mutex mu;
+  std::condition_variable cv;
+};
+
+inline ParkingBucket& BucketFor(const void* addr) {
+  static ParkingBucket buckets[64];
+  return buckets[(reinterpret_cast<std::uintptr_t>(addr) >> 4) & 63];
+}
+
+}  // namespace futex_detail
+
+inline void FutexWait(std::atomic<std::uint32_t>* word, std::uint32_t expected,
+                      std::int64_t timeout_ns) {
+#if defined(__linux__)
+  struct timespec ts;
+  struct timespec* tsp = NULL;
+  if (timeout_ns >= 0) {
+    ts.tv_sec = static_cast<time_t>(timeout_ns / 1000000000);
+    ts.tv_nsec = static_cast<long>(timeout_ns % 1000000000);
+    tsp = &ts;
+  }
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), FUTEX_WAIT_PRIVATE, expected, tsp,
+          NULL, 0);
+#else
+  futex_detail::ParkingBucket& bucket = futex_detail::BucketFor(word);
+  std::unique_lock<std::mutex> lock(bucket.mu);
+  if (word->load(std::memory_order_acquire) != expected) return;
+  if (timeout_ns < 0) {
+    bucket.cv.wait(lock);
+  } else {
+    bucket.cv.wait_for(lock, std::chrono::nanoseconds(timeout_ns));
+  }
+#endif
+}
+
+inline void FutexWakeAll(std::atomic<std::uint32_t>* word) {
+#if defined(__linux__)
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(word), FUTEX_WAKE_PRIVATE, 0x7fffffff, NULL,
+          NULL, 0);
+#else
+  futex_detail::ParkingBucket& bucket = futex_detail::BucketFor(word);
+  { std::lock_guard<std::mutex> lock(bucket.mu); }
+  bucket.cv.notify_all();
+#endif
+}
+
+// 自旋等待时的 CPU 提示（x86 pause / ARM yield），其他平台让出时间片。
+inline void CpuRelax() {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_ia32_pause();
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+  __asm__ __volatile__("yield" ::: "memory");
+#else
+  std::this_thread::yield();
+#endif
+}
+
+// 距 deadline 的剩余纳秒数；deadline 为 time_point::max() 时返回 -1（无限）。
+inline std::int64_t RemainingNanos(std::chrono::steady_clock::time_point deadline) {
+  if (deadline == std::chrono::steady_clock::time_point::max()) return -1;
+  const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if (now >= deadline) return 0;
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+}
+
+}  // namespace task
+}  // namespace corekit
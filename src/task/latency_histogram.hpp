@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// CycleClock
+//
+// 计时热路径使用的时钟：x86 上直接读 TSC（约 10 ns，现代 CPU 的 TSC 恒频且跨核同步），
+// 其他平台退化为 steady_clock 纳秒。读数只在差值意义下有效，换算成纳秒时以一对
+// (TSC, steady_clock) 基准点与当前时刻求比例，无需启动时阻塞校准。
+// ─────────────────────────────────────────────────────────────────────────────
+class CycleClock {
+ public:
+  static std::uint64_t Now() {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_ia32_rdtsc();
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+#endif
+  }
+
+  CycleClock() : base_ticks_(Now()), base_time_(std::chrono::steady_clock::now()) {}
+
+  // 自构造以来观测到的 tick / ns 比例；经过时间过短时按 1 处理。
+  double TicksPerNano() const {
+    const std::uint64_t ticks = Now() - base_ticks_;
+    const std::int64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - base_time_)
+                                   .count();
+    if (nanos < 100000 || ticks == 0) return 1.0;
+    return static_cast<double>(ticks) / static_cast<double>(nanos);
+  }
+
+ private:
+  const std::uint64_t base_ticks_;
+  const std::chrono::steady_clock::time_point base_time_;
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// LatencyHistogram
+//
+// HDR 风格的对数-线性直方图：每个 2 的幂区间再等分 kSubBuckets 份，相对误差 ≤ 1/kSubBuckets，
+// 覆盖完整的 64 位取值范围。单写者（所属工作线程）以 relaxed load + store 递增，不使用
+// 原子 RMW；读者随时可无锁读取近似一致的快照。
+// ─────────────────────────────────────────────────────────────────────────────
+class LatencyHistogram {
+ public:
+  static const std::uint32_t kSubBucketBits = 4;
+  static const std::uint32_t kSubBuckets = 1u << kSubBucketBits;
+  static const std::uint32_t kBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  LatencyHistogram() : count_(0), sum_(0), max_(0) {
+    for (std::uint32_t i = 0; i < kBuckets; ++i) buckets_[i].store(0, std::memory_order_relaxed);
+  }
+
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  // 仅允许单个线程调用。
+  void Record(std::uint64_t value) {
+    Bump(&buckets_[Index(value)], 1);
+    Bump(&count_, 1);
+    Bump(&sum_, value);
+    if (value > max_.load(std::memory_order_relaxed)) {
+      max_.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  // 快照：把本直方图累加到 counts（长度 kBuckets）中。
+  void MergeInto(std::vector<std::uint64_t>* counts, std::uint64_t* count, std::uint64_t* sum,
+                 std::uint64_t* max) const {
+    for (std::uint32_t i = 0; i < kBuckets; ++i) {
+      (*counts)[i] += buckets_[i].load(std::memory_order_relaxed);
+    }
+    *count += count_.load(std::memory_order_relaxed);
+    *sum += sum_.load(std::memory_order_relaxed);
+    const std::uint64_t m = max_.load(std::memory_order_relaxed);
+    if (m > *max) *max = m;
+  }
+
+  static std::uint32_t Index(std::uint64_t value) {
+    if (value < kSubBuckets) return static_cast<std::uint32_t>(value);
+    const std::uint32_t exp = HighestBit(value);
+    return (exp - kSubBucketBits + 1) * kSubBuckets +
+           static_cast<std::uint32_t>((value >> (exp - kSubBucketBits)) & (kSubBuckets - 1));
+  }
+
+  // 桶内最大值（同一桶内的取值都报告为该值）。
+  static std::uint64_t UpperBound(std::uint32_t index) {
+    if (index < kSubBuckets) return index;
+    const std::uint32_t exp = index / kSubBuckets + kSubBucketBits - 1;
+    const std::uint64_t sub = kSubBuckets + index % kSubBuckets;
+    const std::uint32_t shift = exp - kSubBucketBits;
+    return ((sub + 1) << shift) - 1;
+  }
+
+  // 在合并后的计数上求分位数（q ∈ (0, 1]）。
+  static std::uint64_t Percentile(const std::vector<std::uint64_t>& counts, std::uint64_t total,
+                                  double q) {
+    if (total == 0) return 0;
+    std::uint64_t rank = static_cast<std::uint64_t>(q * static_cast<double>(total) + 0.999999);
+    if (rank == 0) rank = 1;
+    if (rank > total) rank = total;
+    std::uint64_t seen = 0;
+    for (std::uint32_t i = 0; i < kBuckets; ++i) {
+      seen += counts[i];
+      if (seen >= rank) return UpperBound(i);
+    }
+    return UpperBound(kBuckets - 1);
+  }
+
+ private:
+  static void Bump(std::atomic<std::uint64_t>* counter, std::uint64_t delta) {
+    counter->store(counter->load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+  }
+
+  static std::uint32_t HighestBit(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<std::uint32_t>(__builtin_clzll(value));
+#else
+    std::uint32_t bit = 0;
+    while (value >>= 1) ++bit;
+    return bit;
+#endif
+  }
+
+  std::atomic<std::uint64_t> buckets_[kBuckets];
+  std::atomic<std::uint64_t> count_;
+  std::atomic<std::uint64_t> sum_;
+  std::atomic<std::uint64_t> max_;
+};
+
+}  // namespace task
+}  // namespace corekit
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// MpmcQueue
+//
+// 有界无锁多生产者多消费者队列（Dmitry Vyukov 的数组队列）。
+// 每个槽位带一个序号：序号 == pos 表示可写入，== pos + 1 表示可读取；生产者与消费者
+// 各自只在自己的游标上 CAS，一次成功的 CAS 即独占一个槽位，随后以 release 发布序号。
+// 严格 FIFO；满时 TryPush 返回 false，由调用方决定退路。容量取不小于参数的 2 的幂。
+// T 须为可平凡拷贝的小类型（通常是指针）。
+// ─────────────────────────────────────────────────────────────────────────────
+template <typename T>
+class MpmcQueue {
+ public:
+  static_assert(std::is_trivially_copyable<T>::value,
+                "MpmcQueue<T> requires a trivially copyable T");
+
+  explicit MpmcQueue(std::size_t capacity = 1024)
+      : mask_(RoundUpPow2(capacity) - 1),
+        cells_(new Cell[mask_ + 1]),
+        enqueue_pos_(0),
+        pad_(),
+        dequeue_pos_(0) {
+    for (std::size_t i = 0; i <= mask_; ++i) cells_[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  // 任意线程压入一个元素。队列已满时返回 false。
+  bool TryPush(T value) {
+    Cell* cell = NULL;
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      const std::size_t seq = cell->seq.load(std::memory_order_acquire);
+      const std::intptr_t dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+      if (dif == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = value;
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // 任意线程取出队首元素。队列为空（或队首尚未发布完成）时返回 false。
+  bool TryPop(T* out) {
+    Cell* cell = NULL;
+    std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      const std::size_t seq = cell->seq.load(std::memory_order_acquire);
+      const std::intptr_t dif =
+          static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+      if (dif == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    *out = cell->value;
+    cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  // 近似元素个数（并发场景下仅作提示）。
+  std::size_t SizeApprox() const {
+    const std::size_t enq = enqueue_pos_.load(std::memory_order_relaxed);
+    const std::size_t deq = dequeue_pos_.load(std::memory_order_relaxed);
+    return enq > deq ? enq - deq : 0;
+  }
+
+  bool EmptyApprox() const { return SizeApprox() == 0; }
+
+  std::size_t Capacity() const { return mask_ + 1; }
+
+ private:
+  struct Cell {
+    std::atomic<std::size_t> seq;
+    T value;
+  };
+
+  static std::size_t RoundUpPow2(std::size_t n) {
+    std::size_t cap = 2;
+    while (cap < n) cap <<= 1;
+    return cap;
+  }
+
+  const std::size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+  // 生产者游标与消费者游标分处不同缓存行，避免两端互相失效。
+  std::atomic<std::size_t> enqueue_pos_;
+  char pad_[64 - sizeof(std::atomic<std::size_t>)];
+  std::atomic<std::size_t> dequeue_pos_;
+};
+
+}  // namespace task
+}  // namespace corekit
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// RateLimiter
+//
+// 无锁令牌桶，以 GCRA（generic cell rate algorithm）形式实现：只维护一个"理论到达时间"
+// tat_，每个令牌把它推后 interval；tat_ 领先当前时间不超过 burst 个 interval 即有令牌可用。
+// 与经典令牌桶等价，但不需要定时补充，也不需要锁：一次 CAS 完成判断与扣减。
+// 一次申请多个令牌时只要求桶内至少有一个令牌，其余记为欠账，由后续申请等待偿还。
+// ─────────────────────────────────────────────────────────────────────────────
+class RateLimiter {
+ public:
+  RateLimiter() : interval_ns_(0), tolerance_ns_(0), tat_(0) {}
+
+  RateLimiter(const RateLimiter&) = delete;
+  RateLimiter& operator=(const RateLimiter&) = delete;
+
+  // per_sec = 0 表示不限速。可在运行时重新配置。
+  void Configure(std::uint32_t per_sec, std::uint32_t burst) {
+    const std::uint64_t interval = per_sec == 0 ? 0 : 1000000000ull / per_sec;
+    tolerance_ns_.store((burst == 0 ? 1 : burst) * interval, std::memory_order_relaxed);
+    interval_ns_.store(interval, std::memory_order_relaxed);
+  }
+
+  bool Enabled() const { return interval_ns_.load(std::memory_order_relaxed) != 0; }
+
+  // 申请 count 个令牌。成功返回 0；否则不扣减，返回还需等待的纳秒数（至少为 1）。
+  std::uint64_t TryAcquire(std::uint64_t count, std::uint64_t now_ns) {
+    const std::uint64_t interval = interval_ns_.load(std::memory_order_relaxed);
+    if (interval == 0) return 0;
+    const std::uint64_t tolerance = tolerance_ns_.load(std::memory_order_relaxed);
+    std::uint64_t tat = tat_.load(std::memory_order_relaxed);
+    for (;;) {
+      const std::uint64_t base = tat > now_ns ? tat : now_ns;
+      // 桶内不足一个令牌：base 需回落到 now + tolerance - interval 以内。
+      if (base + interval > now_ns + tolerance) {
+        const std::uint64_t wait = base + interval - now_ns - tolerance;
+        return wait == 0 ? 1 : wait;
+      }
+      if (tat_.compare_exchange_weak(tat, base + count * interval, std::memory_order_relaxed)) {
+        return 0;
+      }
+    }
+  }
+
+ private:
+  std::atomic<std::uint64_t> interval_ns_;
+  std::atomic<std::uint64_t> tolerance_ns_;
+  std::atomic<std::uint64_t> tat_;
+};
+
+}  // namespace task
+}  // namespace corekit
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "corekit/task/iexecutor.hpp"
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ReadyQueue
+//
+// 按 TaskPriority 分道的侵入式 FIFO 就绪队列，入队/出队均为 O(1)，与队列深度无关。
+// Entry 需提供以下字段：
+//   Entry*        next;           // 侵入式链表指针
+//   TaskPriority  priority;
+//   std::uint64_t seq;            // 入队序号（由 Push 写入）
+//   std::uint64_t dispatch_mark;  // 入队时的出队计数（由 Push 写入）
+//
+// 出队规则：
+//   kFifo / kFair       : 三条通道队首中 seq 最小者（全局 FIFO）。
+//   kPriority           : 非空通道中优先级最高者，同优先级 FIFO。
+//   kHybridFairPriority : 有效优先级 = priority + 等待期间被越过的调度次数 / aging_threshold
+//                         （封顶 kHigh），取有效优先级最高者，相同时取更早入队者。
+//                         aging_threshold = 0 时不老化，与 kPriority 等价。
+// 同一通道内 FIFO，因此只需比较各通道队首，无需扫描整个队列。
+// 非线程安全，由调用方加锁。
+// ─────────────────────────────────────────────────────────────────────────────
+template <typename Entry>
+class ReadyQueue {
+ public:
+  static const std::size_t kLaneCount = 3;
+
+  ReadyQueue() : size_(0), seq_(0), dispatched_(0) {
+    for (std::size_t i = 0; i < kLaneCount; ++i) {
+      lanes_[i].head = NULL;
+      lanes_[i].tail = NULL;
+    }
+  }
+
+  bool Empty() const { return size_ == 0; }
+  std::size_t Size() const { return size_; }
+
+  void Push(Entry* entry) {
+    entry->next = NULL;
+    entry->seq = ++seq_;
+    entry->dispatch_mark = dispatched_;
+    Lane& lane = lanes_[LaneIndex(entry->priority)];
+    if (lane.tail == NULL) {
+      lane.head = entry;
+    } else {
+      lane.tail->next = entry;
+    }
+    lane.tail = entry;
+    ++size_;
+  }
+
+  // 按策略取出下一个任务；队列为空时返回 NULL。
+  Entry* Pop(ExecutorPolicy policy, std::uint32_t aging_threshold) {
+    if (size_ == 0) return NULL;
+    std::size_t pick = kLaneCount;
+    if (policy == ExecutorPolicy::kFifo || policy == ExecutorPolicy::kFair) {
+      for (std::size_t i = 0; i < kLaneCount; ++i) {
+        if (lanes_[i].head == NULL) continue;
+        if (pick == kLaneCount || lanes_[i].head->seq < lanes_[pick].head->seq) pick = i;
+      }
+    } else if (policy == ExecutorPolicy::kPriority || aging_threshold == 0) {
+      for (std::size_t i = kLaneCount; i-- > 0;) {
+        if (lanes_[i].head != NULL) {
+          pick = i;
+          break;
+        }
+      }
+    } else {
+      std::uint64_t best_level = 0;
+      for (std::size_t i = 0; i < kLaneCount; ++i) {
+        const Entry* head = lanes_[i].head;
+        if (head == NULL) continue;
+        std::uint64_t level = i + (dispatched_ - head->dispatch_mark) / aging_threshold;
+        if (level > kLaneCount - 1) level = kLaneCount - 1;
+        if (pick == kLaneCount || level > best_level ||
+            (level == best_level && head->seq < lanes_[pick].head->seq)) {
+          pick = i;
+          best_level = level;
+        }
+      }
+    }
+
+    Lane& lane = lanes_[pick];
+    Entry* entry = lane.head;
+    lane.head = entry->next;
+    if (lane.head == NULL) lane.tail = NULL;
+    entry->next = NULL;
+    --size_;
+    ++dispatched_;
+    return entry;
+  }
+
+  // 移出优先级不高于 max_priority、且 evictable(entry) 为真的最老任务：先看最低优先级通道，
+  // 各通道内从队首向后找第一个可挤出者。用于过载时挤出任务，不计入出队次数（不影响老化）。
+  // 没有符合条件的任务时返回 NULL。
+  template <typename Evictable>
+  Entry* EvictOldest(TaskPriority max_priority, Evictable evictable) {
+    const std::size_t limit = LaneIndex(max_priority);
+    for (std::size_t i = 0; i <= limit; ++i) {
+      Lane& lane = lanes_[i];
+      Entry* prev = NULL;
+      for (Entry* entry = lane.head; entry != NULL; prev = entry, entry = entry->next) {
+        if (!evictable(entry)) continue;
+        if (prev == NULL) {
+          lane.head = entry->next;
+        } else {
+          prev->next = entry->next;
+        }
+        if (lane.tail == entry) lane.tail = prev;
+        entry->next = NULL;
+        --size_;
+        return entry;
+      }
+    }
+    return NULL;
+  }
+
+ private:
+  struct Lane {
+    Entry* head;
+    Entry* tail;
+  };
+
+  static std::size_t LaneIndex(TaskPriority priority) {
+    const std::size_t idx = static_cast<std::size_t>(priority);
+    return idx < kLaneCount ? idx : kLaneCount - 1;
+  }
+
+  Lane lanes_[kLaneCount];
+  std::size_t size_;
+  std::uint64_t seq_;
+  std::uint64_t dispatched_;
+};
+
+}  // namespace task
+}  // namespace corekit
@@ -1,6 +1,10 @@
 #include "task/simple_task_graph.hpp"
 
-#include <queue>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
 
 #include "corekit/api/version.hpp"
 
@@ -9,7 +13,19 @@ namespace task {
 
 #define CK_STATUS(code, message) api::Status::FromModule((code), (message), api::ErrorModule::kTask)
 
-SimpleTaskGraph::SimpleTaskGraph() : next_id_(1) {}
+namespace {
+
+// 非条件边的分支号：只要源节点执行过就激活。
+const std::uint32_t kAlways = static_cast<std::uint32_t>(-1);
+// 不选中任何分支（条件节点失败或源节点未执行）。
+const std::uint32_t kNoBranch = static_cast<std::uint32_t>(-2);
+const std::uint32_t kNone = static_cast<std::uint32_t>(-1);
+// 跳过 / 占位节点在当前线程上递归处理的最大深度，超出后改为提交给执行器。
+const std::uint32_t kMaxInlineDepth = 64;
+
+}  // namespace
+
+SimpleTaskGraph::SimpleTaskGraph() : compiled_(false), version_(0) {}
 SimpleTaskGraph::~SimpleTaskGraph() {}
 
 const char* SimpleTaskGraph::Name() const { return "corekit.task.simple_task_graph"; }
@@ -24,26 +40,78 @@ api::Result<TaskId> SimpleTaskGraph::AddTask(std::function<void()> fn,
     return api::Result<TaskId>(
         CK_STATUS(api::StatusCode::kInvalidArgument, "fn is null"));
   }
-  const TaskId id = next_id_++;
-  TaskNode node;
-  node.id = id;
+  Invalidate();
+  nodes_.push_back(TaskNode());
+  TaskNode& node = nodes_.back();
   node.fn = std::move(fn);
   node.options = options;
   if (options.name != NULL) node.name = options.name;
-  nodes_[id] = node;
-  edges_[id];  // ensure entry exists even if no outgoing edges
-  return api::Result<TaskId>(id);
+  return api::Result<TaskId>(static_cast<TaskId>(nodes_.size()));
+}
+
+api::Result<TaskId> SimpleTaskGraph::AddConditionTask(std::function<std::uint32_t()> fn,
+                                                       const GraphTaskOptions& options) {
+  if (!fn) {
+    return api::Result<TaskId>(
+        CK_STATUS(api::StatusCode::kInvalidArgument, "fn is null"));
+  }
+  Invalidate();
+  nodes_.push_back(TaskNode());
+  TaskNode& node = nodes_.back();
+  node.kind = NodeKind::kCondition;
+  node.condition = std::move(fn);
+  node.options = options;
+  if (options.name != NULL) node.name = options.name;
+  return api::Result<TaskId>(static_cast<TaskId>(nodes_.size()));
+}
+
+api::Result<TaskId> SimpleTaskGraph::AddDynamicTask(std::function<void(ISubflow&)> fn,
+                                                     const GraphTaskOptions& options) {
+  if (!fn) {
+    return api::Result<TaskId>(
+        CK_STATUS(api::StatusCode::kInvalidArgument, "fn is null"));
+  }
+  Invalidate();
+  nodes_.push_back(TaskNode());
+  TaskNode& node = nodes_.back();
+  node.kind = NodeKind::kDynamic;
+  node.dynamic = std::move(fn);
+  node.options = options;
+  if (options.name != NULL) node.name = options.name;
+  return api::Result<TaskId>(static_cast<TaskId>(nodes_.size()));
+}
+
+api::Result<TaskId> SimpleTaskGraph::AddSubgraph(ITaskGraph* graph,
+                                                  const GraphTaskOptions& options) {
+  const SimpleTaskGraph* child = dynamic_cast<const SimpleTaskGraph*>(graph);
+  if (child == NULL || child == this) {
+    return api::Result<TaskId>(
+        CK_STATUS(api::StatusCode::kInvalidArgument, "graph is null, self or foreign"));
+  }
+  Invalidate();
+  nodes_.push_back(TaskNode());
+  TaskNode& node = nodes_.back();
+  node.kind = NodeKind::kSubgraph;
+  node.subgraph = child;
+  node.options = options;
+  if (options.name != NULL) node.name = options.name;
+  return api::Result<TaskId>(static_cast<TaskId>(nodes_.size()));
 }
 
 api::Status SimpleTaskGraph::AddDependency(TaskId before_task_id, TaskId after_task_id) {
   if (before_task_id == after_task_id) {
     return CK_STATUS(api::StatusCode::kInvalidArgument, "self dependency is not allowed");
   }
-  if (nodes_.find(before_task_id) == nodes_.end() ||
-      nodes_.find(after_task_id) == nodes_.end()) {
+  if (before_task_id == 0 || before_task_id > nodes_.size() || after_task_id == 0 ||
+      after_task_id > nodes_.size()) {
     return CK_STATUS(api::StatusCode::kNotFound, "task id not found");
   }
-  edges_[before_task_id].insert(after_task_id);
+  std::vector<std::uint32_t>& out = nodes_[before_task_id - 1].successors;
+  const std::uint32_t after = static_cast<std::uint32_t>(after_task_id - 1);
+  if (std::find(out.begin(), out.end(), after) == out.end()) {
+    Invalidate();
+    out.push_back(after);
+  }
   return api::Status::Ok();
 }
 
@@ -60,75 +128,232 @@ api::Status SimpleTaskGraph::AddDependencies(TaskId after_task_id,
   return api::Status::Ok();
 }
 
-// ── Validate / Clear ──────────────────────────────────────────────────────────
+// ── 展开子图 ───────────────────────────────────────────────────────────────────
+//
+// 子图节点展开为 入口占位 → 子图各节点 → 出口占位：入口连向子图的根，子图的汇点连向出口，
+// 父图中指向 / 来自该节点的边改接到入口 / 出口上，边数保持线性。
 
-api::Status SimpleTaskGraph::BuildIndegree(std::map<TaskId, std::size_t>* indegree) const {
-  if (indegree == NULL) {
-    return CK_STATUS(api::StatusCode::kInvalidArgument, "indegree is null");
+bool SimpleTaskGraph::EmbeddedStale() const {
+  for (std::size_t i = 0; i < plan_.embedded.size(); ++i) {
+    if (plan_.embedded[i].first->version_ != plan_.embedded[i].second) return true;
   }
-  indegree->clear();
-  for (std::map<TaskId, TaskNode>::const_iterator it = nodes_.begin();
-       it != nodes_.end(); ++it) {
-    (*indegree)[it->first] = 0;
+  return false;
+}
+
+api::Status SimpleTaskGraph::Expand(FlatGraph* flat, std::vector<const SimpleTaskGraph*>* stack,
+                                    std::vector<std::uint32_t>* entry,
+                                    std::vector<std::uint32_t>* exit) const {
+  if (std::find(stack->begin(), stack->end(), this) != stack->end()) {
+    return CK_STATUS(api::StatusCode::kInvalidArgument, "subgraphs embed each other");
   }
-  for (std::map<TaskId, std::set<TaskId> >::const_iterator eit = edges_.begin();
-       eit != edges_.end(); ++eit) {
-    for (std::set<TaskId>::const_iterator dst = eit->second.begin();
-         dst != eit->second.end(); ++dst) {
-      if (indegree->find(*dst) == indegree->end()) {
-        return CK_STATUS(api::StatusCode::kInternalError, "edge references missing node");
+  stack->push_back(this);
+
+  const std::size_t n = nodes_.size();
+  entry->assign(n, 0);
+  exit->assign(n, 0);
+  for (std::size_t i = 0; i < n; ++i) {
+    const TaskNode& node = nodes_[i];
+    const std::uint32_t first = static_cast<std::uint32_t>(flat->body.size());
+    if (node.kind != NodeKind::kSubgraph) {
+      flat->body.push_back(&node);
+      flat->successors.resize(flat->body.size());
+      (*entry)[i] = (*exit)[i] = first;
+      continue;
+    }
+
+    const SimpleTaskGraph* child = node.subgraph;
+    flat->embedded.push_back(std::make_pair(child, child->version_));
+    flat->body.push_back(NULL);
+    flat->successors.resize(flat->body.size());
+    std::vector<std::uint32_t> child_entry;
+    std::vector<std::uint32_t> child_exit;
+    api::Status st = child->Expand(flat, stack, &child_entry, &child_exit);
+    if (!st.ok()) {
+      stack->pop_back();
+      return st;
+    }
+    const std::uint32_t last = static_cast<std::uint32_t>(flat->body.size());
+    flat->body.push_back(NULL);
+    flat->successors.resize(flat->body.size());
+
+    std::vector<bool> has_pred(child->nodes_.size(), false);
+    for (std::size_t j = 0; j < child->nodes_.size(); ++j) {
+      const std::vector<std::uint32_t>& out = child->nodes_[j].successors;
+      for (std::size_t k = 0; k < out.size(); ++k) has_pred[out[k]] = true;
+    }
+    for (std::size_t j = 0; j < child->nodes_.size(); ++j) {
+      if (!has_pred[j]) flat->successors[first].push_back(std::make_pair(child_entry[j], kAlways));
+      if (child->nodes_[j].successors.empty()) {
+        flat->successors[child_exit[j]].push_back(std::make_pair(last, kAlways));
       }
-      ++(*indegree)[*dst];
     }
+    if (child->nodes_.empty()) flat->successors[first].push_back(std::make_pair(last, kAlways));
+    (*entry)[i] = first;
+    (*exit)[i] = last;
   }
+
+  for (std::size_t i = 0; i < n; ++i) {
+    const TaskNode& node = nodes_[i];
+    for (std::size_t k = 0; k < node.successors.size(); ++k) {
+      const std::uint32_t branch =
+          node.kind == NodeKind::kCondition ? static_cast<std::uint32_t>(k) : kAlways;
+      flat->successors[(*exit)[i]].push_back(
+          std::make_pair((*entry)[node.successors[k]], branch));
+    }
+  }
+  stack->pop_back();
   return api::Status::Ok();
 }
 
-api::Status SimpleTaskGraph::Validate() const {
-  std::map<TaskId, std::size_t> indegree;
-  api::Status st = BuildIndegree(&indegree);
-  if (!st.ok()) return st;
+api::Status SimpleTaskGraph::Flatten(FlatGraph* flat) const {
+  std::vector<const SimpleTaskGraph*> stack;
+  std::vector<std::uint32_t> entry;
+  std::vector<std::uint32_t> exit;
+  return Expand(flat, &stack, &entry, &exit);
+}
 
-  std::queue<TaskId> ready;
-  for (std::map<TaskId, std::size_t>::const_iterator it = indegree.begin();
-       it != indegree.end(); ++it) {
-    if (it->second == 0) ready.push(it->first);
-  }
-
-  std::size_t processed = 0;
-  while (!ready.empty()) {
-    const TaskId id = ready.front();
-    ready.pop();
-    ++processed;
-
-    std::map<TaskId, std::set<TaskId> >::const_iterator out = edges_.find(id);
-    if (out == edges_.end()) continue;
-    for (std::set<TaskId>::const_iterator dst = out->second.begin();
-         dst != out->second.end(); ++dst) {
-      std::map<TaskId, std::size_t>::iterator d = indegree.find(*dst);
-      if (d == indegree.end()) {
-        return CK_STATUS(api::StatusCode::kInternalError,
-                         "indegree missing for destination node");
-      }
-      if (d->second > 0) --d->second;
-      if (d->second == 0) ready.push(*dst);
+// ── Validate / Compile / Clear ────────────────────────────────────────────────
+
+bool SimpleTaskGraph::TopologicalOrder(const FlatGraph& flat, std::vector<std::uint32_t>* order) {
+  const std::size_t n = flat.body.size();
+  std::vector<std::uint32_t> indegree(n, 0);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t k = 0; k < flat.successors[i].size(); ++k) {
+      ++indegree[flat.successors[i][k].first];
     }
   }
 
-  if (processed != nodes_.size()) {
+  // Kahn 拓扑排序：order 同时充当队列，processed 为出队位置。
+  order->clear();
+  order->reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (indegree[i] == 0) order->push_back(static_cast<std::uint32_t>(i));
+  }
+  for (std::size_t processed = 0; processed < order->size(); ++processed) {
+    const std::vector<std::pair<std::uint32_t, std::uint32_t> >& out =
+        flat.successors[(*order)[processed]];
+    for (std::size_t k = 0; k < out.size(); ++k) {
+      if (--indegree[out[k].first] == 0) order->push_back(out[k].first);
+    }
+  }
+  return order->size() == n;
+}
+
+api::Status SimpleTaskGraph::Validate() const {
+  if (compiled_ && !EmbeddedStale()) return api::Status::Ok();
+  FlatGraph flat;
+  api::Status st = Flatten(&flat);
+  if (!st.ok()) return st;
+  std::vector<std::uint32_t> order;
+  if (!TopologicalOrder(flat, &order)) {
+    return CK_STATUS(api::StatusCode::kInvalidArgument,
+                     "task graph contains cycle or unresolved dependency");
+  }
+  return api::Status::Ok();
+}
+
+api::Status SimpleTaskGraph::Compile() {
+  if (compiled_) {
+    if (!EmbeddedStale()) return api::Status::Ok();
+    Invalidate();
+  }
+  FlatGraph flat;
+  api::Status st = Flatten(&flat);
+  if (!st.ok()) return st;
+  Plan& plan = plan_;
+  if (!TopologicalOrder(flat, &plan.order)) {
     return CK_STATUS(api::StatusCode::kInvalidArgument,
                      "task graph contains cycle or unresolved dependency");
   }
+
+  const std::size_t n = flat.body.size();
+  plan.body.swap(flat.body);
+  plan.embedded.swap(flat.embedded);
+  plan.task_count = 0;
+  plan.edge_begin.assign(n + 1, 0);
+  plan.edges.clear();
+  plan.edge_branch.clear();
+  plan.indegree.assign(n, 0);
+  plan.roots.clear();
+  for (std::size_t i = 0; i < n; ++i) {
+    if (plan.body[i] != NULL) ++plan.task_count;
+    plan.edge_begin[i] = static_cast<std::uint32_t>(plan.edges.size());
+    const std::vector<std::pair<std::uint32_t, std::uint32_t> >& out = flat.successors[i];
+    for (std::size_t k = 0; k < out.size(); ++k) {
+      plan.edges.push_back(out[k].first);
+      plan.edge_branch.push_back(out[k].second);
+      ++plan.indegree[out[k].first];
+    }
+  }
+  plan.edge_begin[n] = static_cast<std::uint32_t>(plan.edges.size());
+  for (std::size_t i = 0; i < n; ++i) {
+    if (plan.indegree[i] == 0) plan.roots.push_back(static_cast<std::uint32_t>(i));
+  }
+  plan.buffers.reset(new RunBuffers(n));
+  plan.ready.assign(n, 0);
+  plan.pending.clear();
+  plan.pending.reserve(n);
+  plan.rank.assign(n, 0);
+  plan.ranked_roots = plan.roots;
+  plan.measured_ns.assign(n, 0);
+  // 编译时即算好秩，供 ISubflow::SpawnGraph 在运行期只读使用。
+  ComputeRanks();
+  compiled_ = true;
   return api::Status::Ok();
 }
 
 api::Status SimpleTaskGraph::Clear() {
   nodes_.clear();
-  edges_.clear();
-  next_id_ = 1;
+  Invalidate();
   return api::Status::Ok();
 }
 
+SimpleTaskGraph::RunBuffers::RunBuffers(std::size_t n)
+    : remaining(new std::atomic<std::uint32_t>[n == 0 ? 1 : n]),
+      activated(new std::atomic<std::uint8_t>[n == 0 ? 1 : n]),
+      joins(new std::atomic<std::uint32_t>[n == 0 ? 1 : n]),
+      child_failed(new std::atomic<std::uint8_t>[n == 0 ? 1 : n]) {}
+
+void SimpleTaskGraph::RunBuffers::Reset(const Plan& plan) {
+  for (std::size_t i = 0; i < plan.indegree.size(); ++i) {
+    remaining[i].store(plan.indegree[i], std::memory_order_relaxed);
+    activated[i].store(plan.indegree[i] == 0 ? 1 : 0, std::memory_order_relaxed);
+    joins[i].store(0, std::memory_order_relaxed);
+    child_failed[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+// ── 关键路径 ───────────────────────────────────────────────────────────────────
+
+std::uint64_t SimpleTaskGraph::NodeCost(std::uint32_t index) const {
+  const TaskNode* body = plan_.body[index];
+  if (body == NULL) return 0;
+  const std::uint32_t hint = body->options.cost_hint_us;
+  if (hint != 0) return static_cast<std::uint64_t>(hint) * 1000;
+  const std::uint64_t measured = plan_.measured_ns[index];
+  return measured != 0 ? measured : 1000;
+}
+
+void SimpleTaskGraph::ComputeRanks() {
+  // 逆拓扑序一遍：rank(i) = cost(i) + max(rank(后继))。
+  Plan& plan = plan_;
+  for (std::size_t k = plan.order.size(); k-- > 0;) {
+    const std::uint32_t i = plan.order[k];
+    std::uint64_t tail = 0;
+    for (std::uint32_t e = plan.edge_begin[i]; e < plan.edge_begin[i + 1]; ++e) {
+      tail = std::max(tail, plan.rank[plan.edges[e]]);
+    }
+    plan.rank[i] = NodeCost(i) + tail;
+  }
+  // 同秩按下标升序；std::sort 不像 stable_sort 那样申请临时缓冲，重算秩不分配内存。
+  const std::vector<std::uint64_t>& rank = plan.rank;
+  std::sort(plan.ranked_roots.begin(), plan.ranked_roots.end(),
+            [&rank](std::uint32_t a, std::uint32_t b) {
+              return rank[a] != rank[b] ? rank[a] > rank[b] : a < b;
+            });
+  plan.ranks_dirty = false;
+}
+
 // ── Run / RunWithExecutor ─────────────────────────────────────────────────────
 
 api::Result<GraphRunStats> SimpleTaskGraph::Run() {
@@ -151,143 +376,490 @@ api::Result<GraphRunStats> SimpleTaskGraph::RunWithExecutor(IExecutor* executor,
 
 api::Result<GraphRunStats> SimpleTaskGraph::RunInternal(IExecutor* executor,
                                                          const GraphRunOptions& options) {
-  api::Status validate = Validate();
-  if (!validate.ok()) return api::Result<GraphRunStats>(validate);
+  // 已编译的图直接复用 Plan，只重置计数；否则先编译（展开子图 + 校验 + 建 CSR）。
+  api::Status compile = Compile();
+  if (!compile.ok()) return api::Result<GraphRunStats>(compile);
+
+  plan_.buffers->Reset(plan_);
+  if (executor == NULL) return RunInline(options);
+  if (options.schedule == GraphSchedule::kCriticalPath && plan_.ranks_dirty) ComputeRanks();
+  return RunDataflow(executor, options);
+}
+
+// 动态节点的子工作句柄。st 为 NULL 时处于同步 Run()：子工作在调用时直接执行。
+class SimpleTaskGraph::Subflow : public ISubflow {
+ public:
+  Subflow(RunState* st, std::uint32_t index, const GraphRunOptions& options)
+      : st_(st), index_(index), options_(options), failed_(false) {}
 
-  std::map<TaskId, std::size_t> indegree;
-  api::Status indegree_st = BuildIndegree(&indegree);
-  if (!indegree_st.ok()) return api::Result<GraphRunStats>(indegree_st);
+  api::Status Spawn(std::function<void()> fn) override;
+  api::Status SpawnGraph(ITaskGraph* graph) override;
 
-  std::queue<TaskId> ready;
-  for (std::map<TaskId, std::size_t>::const_iterator it = indegree.begin();
-       it != indegree.end(); ++it) {
-    if (it->second == 0) ready.push(it->first);
+  bool failed() const { return failed_; }
+
+ private:
+  RunState* const st_;
+  const std::uint32_t index_;
+  const GraphRunOptions& options_;
+  bool failed_;
+};
+
+api::Result<GraphRunStats> SimpleTaskGraph::RunInline(const GraphRunOptions& options) {
+  GraphRunStats stats;
+  stats.total = static_cast<std::uint64_t>(plan_.task_count);
+  RunBuffers& buffers = *plan_.buffers;
+
+  // plan_.ready 作为 FIFO 队列：[head, tail) 为待处理节点，每个节点恰好入队一次。
+  std::vector<std::uint32_t>& ready = plan_.ready;
+  std::size_t tail = 0;
+  for (std::size_t i = 0; i < plan_.roots.size(); ++i) ready[tail++] = plan_.roots[i];
+
+  for (std::size_t head = 0; head < tail; ++head) {
+    const std::uint32_t i = ready[head];
+    const TaskNode* node = plan_.body[i];
+    const bool ran = buffers.activated[i].load(std::memory_order_relaxed) != 0;
+    std::uint32_t selected = kNoBranch;
+    if (!ran) {
+      if (node != NULL) ++stats.skipped;
+    } else if (node != NULL) {
+      bool failed = false;
+      try {
+        if (node->kind == NodeKind::kCondition) {
+          selected = node->condition();
+        } else if (node->kind == NodeKind::kDynamic) {
+          Subflow subflow(NULL, i, options);
+          node->dynamic(subflow);
+          failed = subflow.failed();
+        } else {
+          node->fn();
+        }
+      } catch (...) {
+        failed = true;
+      }
+      if (failed) {
+        ++stats.failed;
+        if (options.fail_fast) break;
+        selected = kNoBranch;
+      } else {
+        ++stats.succeeded;
+      }
+    }
+    for (std::uint32_t e = plan_.edge_begin[i]; e < plan_.edge_begin[i + 1]; ++e) {
+      const std::uint32_t d = plan_.edges[e];
+      const std::uint32_t branch = plan_.edge_branch[e];
+      if (ran && (branch == kAlways || branch == selected)) {
+        buffers.activated[d].store(1, std::memory_order_relaxed);
+      }
+      if (buffers.remaining[d].fetch_sub(1, std::memory_order_relaxed) == 1) ready[tail++] = d;
+    }
   }
 
+  stats.canceled = stats.total - stats.succeeded - stats.failed - stats.skipped;
+  return api::Result<GraphRunStats>(stats);
+}
+
+// ── 数据流执行 ─────────────────────────────────────────────────────────────────
+//
+// 每个节点带一个剩余前驱计数；节点结束时由完成它的工作线程递减后继的计数，归零的后继
+// 立即提交，不存在层间屏障：一个慢节点只阻塞它自己的后继。新就绪的第一个后继直接在
+// 当前线程继续执行（链式依赖少一次入队），其余提交给执行器。未被激活的节点（条件分支
+// 未选中）与子图占位节点不执行函数体，就地沿出边传播。
+//
+// active 计数在途的节点（已提交、排队等待并发额度、或正在执行），调用线程自身也持有
+// 一个计数，保证初始提交完成前不会被判定结束；归零时唤醒调用线程。RunState 位于
+// 调用线程栈上，最后一个节点在持锁状态下通知，调用线程拿到锁时工作线程已不再访问它。
+// 动态节点在子工作结束前额外持有一个计数；SpawnGraph 派生的子图运行使用堆上的
+// RunState，计数归零时通知父节点并自行释放。
+
+struct SimpleTaskGraph::RunState {
+  RunState(SimpleTaskGraph* g, IExecutor* e, const GraphRunOptions& o, std::size_t limit,
+           RunBuffers* b)
+      : plan(g->plan_),
+        buffers(b),
+        executor(e),
+        options(o),
+        critical(o.schedule == GraphSchedule::kCriticalPath),
+        cap(limit),
+        parent(NULL),
+        parent_index(0),
+        succeeded(0),
+        failed(0),
+        skipped(0),
+        measured(false),
+        stop(false),
+        active(1),
+        running(0),
+        pending(g->plan_.pending),
+        pending_seq(0),
+        done(false),
+        error(api::Status::Ok()) {}
+
+  // 等待并发额度的就绪节点：大根堆，键为秩（kCriticalPath）或就绪序号的反码（kFifo）。
+  typedef std::pair<std::uint64_t, std::uint32_t> PendingEntry;
+
+  Plan& plan;
+  RunBuffers* const buffers;
+  // 派生子图运行自有的计数数组（顶层运行为空，使用 plan.buffers）。
+  std::unique_ptr<RunBuffers> owned_buffers;
+  IExecutor* const executor;
+  const GraphRunOptions options;
+  const bool critical;
+  // 同时在途的节点上限，0 = 不限制。
+  const std::size_t cap;
+  // SpawnGraph 派生的子图运行：所属的父运行与动态节点。
+  RunState* parent;
+  std::uint32_t parent_index;
+  std::atomic<std::uint64_t> succeeded;
+  std::atomic<std::uint64_t> failed;
+  std::atomic<std::uint64_t> skipped;
+  // 本次运行是否更新了 measured_ns（需要在下次运行前重算秩）。
+  std::atomic<bool> measured;
+  // fail_fast 下首个失败、或提交失败后置位：不再启动新节点。
+  std::atomic<bool> stop;
+  std::atomic<std::size_t> active;
+
+  std::mutex mu;
+  std::condition_variable done_cv;
+  // 以下受 mu 保护。running / pending 仅在 cap > 0 时使用（派生的子图运行不限并发，
+  // 不会访问所引用的 plan.pending）。
+  std::size_t running;
+  std::vector<PendingEntry>& pending;
+  std::uint64_t pending_seq;
+  bool done;
+  api::Status error;
+
+  void PushPending(std::uint32_t index) {
+    const std::uint64_t key = critical ? plan.rank[index] : ~pending_seq++;
+    pending.push_back(PendingEntry(key, index));
+    std::push_heap(pending.begin(), pending.end());
+  }
+
+  std::uint32_t PopPending() {
+    std::pop_heap(pending.begin(), pending.end());
+    const std::uint32_t index = pending.back().second;
+    pending.pop_back();
+    return index;
+  }
+};
+
+api::Result<GraphRunStats> SimpleTaskGraph::RunDataflow(IExecutor* executor,
+                                                         const GraphRunOptions& options) {
+  // kCriticalPath 默认只放出与工作线程数相同的节点，其余留在图内按秩排队，
+  // 否则执行器队列按 FIFO 取任务，派发顺序不再由秩决定。弹性执行器按 max_workers 放行：
+  // 只按当前线程数放行时队列不会积压，执行器也就不会扩容。
+  std::size_t cap = options.max_concurrency;
+  if (cap == 0 && options.schedule == GraphSchedule::kCriticalPath) {
+    api::Result<ExecutorStats> stats = executor->QueryStats();
+    if (stats.ok()) {
+      cap = stats.value().max_workers > stats.value().worker_count ? stats.value().max_workers
+                                                                   : stats.value().worker_count;
+    }
+  }
+
+  RunState st(this, executor, options, cap, plan_.buffers.get());
+  plan_.pending.clear();
+  const std::vector<std::uint32_t>& roots = st.critical ? plan_.ranked_roots : plan_.roots;
+  for (std::size_t i = 0; i < roots.size() && !st.stop.load(std::memory_order_acquire); ++i) {
+    Dispatch(&st, roots[i]);
+  }
+  ReleaseActive(&st, 1);
+  {
+    std::unique_lock<std::mutex> lock(st.mu);
+    st.done_cv.wait(lock, [&st]() { return st.done; });
+    if (!st.error.ok()) return api::Result<GraphRunStats>(st.error);
+  }
+  if (st.measured.load(std::memory_order_relaxed)) plan_.ranks_dirty = true;
+
   GraphRunStats stats;
-  stats.total = static_cast<std::uint64_t>(nodes_.size());
-  std::size_t processed = 0;
-
-  while (!ready.empty()) {
-    // 收集当前层（受 max_concurrency 限制）
-    const std::size_t level_cap =
-        options.max_concurrency == 0
-            ? static_cast<std::size_t>(-1)
-            : static_cast<std::size_t>(options.max_concurrency);
-
-    std::vector<TaskId> level;
-    while (!ready.empty() && level.size() < level_cap) {
-      level.push_back(ready.front());
-      ready.pop();
+  stats.total = static_cast<std::uint64_t>(plan_.task_count);
+  stats.succeeded = st.succeeded.load(std::memory_order_relaxed);
+  stats.failed = st.failed.load(std::memory_order_relaxed);
+  stats.skipped = st.skipped.load(std::memory_order_relaxed);
+  stats.canceled = stats.total - stats.succeeded - stats.failed - stats.skipped;
+  return api::Result<GraphRunStats>(stats);
+}
+
+void SimpleTaskGraph::RunNode(RunState* st, std::uint32_t index) {
+  for (;;) {
+    std::uint32_t next = kNone;
+    Visit(st, index, &next, 0);
+    if (next != kNone && st->critical && st->cap != 0) next = PreferPending(st, next);
+    // 直接执行的后继沿用当前节点的 active 计数与并发额度。
+    if (next == kNone) break;
+    index = next;
+  }
+  FinishNode(st);
+}
+
+void SimpleTaskGraph::Visit(RunState* st, std::uint32_t index, std::uint32_t* next,
+                            std::uint32_t depth) {
+  if (st->stop.load(std::memory_order_acquire)) return;
+  RunBuffers& buffers = *st->buffers;
+  const TaskNode* node = st->plan.body[index];
+  if (buffers.activated[index].load(std::memory_order_relaxed) == 0) {
+    if (node != NULL) st->skipped.fetch_add(1, std::memory_order_relaxed);
+    ReleaseSuccessors(st, index, false, kNoBranch, next, depth);
+    return;
+  }
+  if (node == NULL) {
+    ReleaseSuccessors(st, index, true, kNoBranch, next, depth);
+    return;
+  }
+
+  // 关键路径模式下为没有 cost_hint 的节点记录实测耗时（滑动平均，权重 1/4）。
+  // 派生的子图运行只读使用其编译结果，不记录。
+  const bool measure =
+      st->critical && st->parent == NULL && node->options.cost_hint_us == 0;
+  const std::chrono::steady_clock::time_point begin =
+      measure ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+  bool failed = false;
+  std::uint32_t selected = kNoBranch;
+  if (node->kind == NodeKind::kDynamic) {
+    st->active.fetch_add(1, std::memory_order_relaxed);
+    buffers.joins[index].store(1, std::memory_order_relaxed);
+    Subflow subflow(st, index, st->options);
+    try {
+      node->dynamic(subflow);
+    } catch (...) {
+      buffers.child_failed[index].store(1, std::memory_order_relaxed);
+    }
+  } else {
+    try {
+      if (node->kind == NodeKind::kCondition) {
+        selected = node->condition();
+      } else {
+        node->fn();
+      }
+    } catch (...) {
+      failed = true;
     }
+  }
+  if (measure) {
+    const std::uint64_t ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                             begin)
+            .count());
+    std::uint64_t& avg = st->plan.measured_ns[index];
+    avg = avg == 0 ? ns + 1 : avg - avg / 4 + ns / 4;
+    st->measured.store(true, std::memory_order_relaxed);
+  }
+
+  if (node->kind == NodeKind::kDynamic) {
+    // 子工作全部结束（含节点函数本身）的一方负责完成该节点。
+    if (buffers.joins[index].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      CompleteDynamic(st, index, next);
+    }
+    return;
+  }
+  (failed ? st->failed : st->succeeded).fetch_add(1, std::memory_order_relaxed);
+  if (failed && st->options.fail_fast) {
+    st->stop.store(true, std::memory_order_release);
+    return;
+  }
+  ReleaseSuccessors(st, index, true, failed ? kNoBranch : selected, next, depth);
+}
 
-    bool level_failed = false;
+void SimpleTaskGraph::ReleaseSuccessors(RunState* st, std::uint32_t index, bool ran,
+                                        std::uint32_t selected, std::uint32_t* next,
+                                        std::uint32_t depth) {
+  RunBuffers& buffers = *st->buffers;
+  const Plan& plan = st->plan;
+  for (std::uint32_t e = plan.edge_begin[index]; e < plan.edge_begin[index + 1]; ++e) {
+    const std::uint32_t d = plan.edges[e];
+    const std::uint32_t branch = plan.edge_branch[e];
+    if (ran && (branch == kAlways || branch == selected)) {
+      buffers.activated[d].store(1, std::memory_order_relaxed);
+    }
+    if (buffers.remaining[d].fetch_sub(1, std::memory_order_acq_rel) != 1) continue;
+    // 跳过的节点与占位节点不执行函数体，就地传播（深度受限，避免长链递归过深）。
+    if ((buffers.activated[d].load(std::memory_order_relaxed) == 0 || plan.body[d] == NULL) &&
+        depth < kMaxInlineDepth) {
+      Visit(st, d, next, depth + 1);
+      continue;
+    }
+    // 新就绪的后继中秩最大者留给当前线程继续执行，其余派发。
+    if (*next == kNone) {
+      *next = d;
+    } else if (st->critical && plan.rank[d] > plan.rank[*next]) {
+      Dispatch(st, *next);
+      *next = d;
+    } else {
+      Dispatch(st, d);
+    }
+  }
+}
 
-    if (executor == NULL) {
-      // 同步内联执行
-      for (std::size_t i = 0; i < level.size(); ++i) {
-        std::map<TaskId, TaskNode>::const_iterator nit = nodes_.find(level[i]);
-        if (nit == nodes_.end()) {
-          return api::Result<GraphRunStats>(
-              CK_STATUS(api::StatusCode::kInternalError, "node missing during execution"));
-        }
+void SimpleTaskGraph::CompleteDynamic(RunState* st, std::uint32_t index, std::uint32_t* next) {
+  const bool failed = st->buffers->child_failed[index].load(std::memory_order_relaxed) != 0;
+  (failed ? st->failed : st->succeeded).fetch_add(1, std::memory_order_relaxed);
+  if (failed && st->options.fail_fast) {
+    st->stop.store(true, std::memory_order_release);
+  } else {
+    // 由子工作所在线程完成时不持有并发额度，新就绪的后继全部派发。
+    std::uint32_t local = kNone;
+    ReleaseSuccessors(st, index, true, kNoBranch, next != NULL ? next : &local, 0);
+    if (local != kNone) Dispatch(st, local);
+  }
+  ReleaseActive(st, 1);
+}
+
+void SimpleTaskGraph::JoinChild(RunState* st, std::uint32_t index) {
+  if (st->buffers->joins[index].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    CompleteDynamic(st, index, NULL);
+  }
+}
+
+api::Status SimpleTaskGraph::Subflow::Spawn(std::function<void()> fn) {
+  if (!fn) return CK_STATUS(api::StatusCode::kInvalidArgument, "fn is null");
+  if (st_ == NULL) {
+    try {
+      fn();
+    } catch (...) {
+      failed_ = true;
+    }
+    return api::Status::Ok();
+  }
+
+  RunState* st = st_;
+  const std::uint32_t index = index_;
+  st->buffers->joins[index].fetch_add(1, std::memory_order_relaxed);
+  TaskSubmitOptions submit_opts;
+  submit_opts.priority = st->plan.body[index]->options.priority;
+  api::Status sub = st->executor->SubmitTask(
+      TaskFunction([st, index, fn]() {
         try {
-          nit->second.fn();
-          ++stats.succeeded;
+          fn();
         } catch (...) {
-          ++stats.failed;
-          level_failed = true;
-        }
-      }
-    } else {
-      // 通过执行器并行执行当前层
-      struct NodeCtx {
-        std::function<void()> fn;
-        bool failed;
-      };
-      std::vector<NodeCtx> ctx(level.size());
-      std::vector<TaskId> ids;
-      ids.reserve(level.size());
-
-      for (std::size_t i = 0; i < level.size(); ++i) {
-        std::map<TaskId, TaskNode>::const_iterator nit = nodes_.find(level[i]);
-        if (nit == nodes_.end()) {
-          return api::Result<GraphRunStats>(
-              CK_STATUS(api::StatusCode::kInternalError, "node missing during execution"));
-        }
-        ctx[i].fn = nit->second.fn;
-        ctx[i].failed = false;
-
-        NodeCtx* ctxp = &ctx[i];
-        TaskSubmitOptions submit_opts;
-        submit_opts.priority = nit->second.options.priority;
-
-        api::Result<TaskId> sub = executor->SubmitEx(
-            [ctxp]() {
-              try {
-                ctxp->fn();
-              } catch (...) {
-                ctxp->failed = true;
-              }
-            },
-            submit_opts);
-
-        if (!sub.ok()) {
-          if (!ids.empty()) (void)executor->WaitBatch(&ids[0], ids.size(), 0);
-          return api::Result<GraphRunStats>(sub.status());
+          st->buffers->child_failed[index].store(1, std::memory_order_relaxed);
         }
-        ids.push_back(sub.value());
-      }
+        JoinChild(st, index);
+      }),
+      submit_opts, NULL);
+  if (!sub.ok()) {
+    st->buffers->child_failed[index].store(1, std::memory_order_relaxed);
+    JoinChild(st, index);
+  }
+  return sub;
+}
 
-      api::Status wait_st =
-          executor->WaitBatch(ids.empty() ? NULL : &ids[0], ids.size(), 0);
-      if (!wait_st.ok()) {
-        return api::Result<GraphRunStats>(wait_st);
-      }
+api::Status SimpleTaskGraph::Subflow::SpawnGraph(ITaskGraph* graph) {
+  SimpleTaskGraph* child = dynamic_cast<SimpleTaskGraph*>(graph);
+  if (child == NULL || !child->compiled_ || child->EmbeddedStale()) {
+    return CK_STATUS(api::StatusCode::kInvalidArgument,
+                     "graph is null, foreign or not compiled");
+  }
+  if (st_ == NULL) {
+    api::Result<GraphRunStats> r = child->RunInternal(NULL, options_);
+    if (!r.ok() || r.value().failed != 0 || r.value().canceled != 0) failed_ = true;
+    return api::Status::Ok();
+  }
+  StartNested(st_, index_, child);
+  return api::Status::Ok();
+}
 
-      for (std::size_t i = 0; i < ctx.size(); ++i) {
-        if (ctx[i].failed) {
-          ++stats.failed;
-          level_failed = true;
-        } else {
-          ++stats.succeeded;
-        }
-      }
+void SimpleTaskGraph::StartNested(RunState* parent, std::uint32_t index, SimpleTaskGraph* graph) {
+  GraphRunOptions options = parent->options;
+  options.max_concurrency = 0;
+  const Plan& plan = graph->plan_;
+  std::unique_ptr<RunBuffers> buffers(new RunBuffers(plan.body.size()));
+  buffers->Reset(plan);
+  RunState* st = new RunState(graph, parent->executor, options, 0, buffers.get());
+  st->owned_buffers = std::move(buffers);
+  st->parent = parent;
+  st->parent_index = index;
+
+  parent->buffers->joins[index].fetch_add(1, std::memory_order_relaxed);
+  const std::vector<std::uint32_t>& roots = st->critical ? plan.ranked_roots : plan.roots;
+  for (std::size_t i = 0; i < roots.size() && !st->stop.load(std::memory_order_acquire); ++i) {
+    Dispatch(st, roots[i]);
+  }
+  ReleaseActive(st, 1);
+}
+
+void SimpleTaskGraph::Dispatch(RunState* st, std::uint32_t index) {
+  st->active.fetch_add(1, std::memory_order_relaxed);
+  if (st->cap != 0) {
+    std::lock_guard<std::mutex> lock(st->mu);
+    if (st->running >= st->cap) {
+      st->PushPending(index);
+      return;
     }
+    ++st->running;
+  }
+  if (!SubmitNode(st, index)) FinishNode(st);
+}
 
-    processed += level.size();
+bool SimpleTaskGraph::SubmitNode(RunState* st, std::uint32_t index) {
+  TaskSubmitOptions submit_opts;
+  const TaskNode* body = st->plan.body[index];
+  if (body != NULL) submit_opts.priority = body->options.priority;
+  api::Status sub = st->executor->SubmitTask(
+      TaskFunction([st, index]() { RunNode(st, index); }), submit_opts, NULL);
+  if (sub.ok()) return true;
+
+  std::lock_guard<std::mutex> lock(st->mu);
+  if (st->error.ok()) st->error = sub;
+  st->stop.store(true, std::memory_order_release);
+  return false;
+}
 
-    if (level_failed && options.fail_fast) {
-      stats.canceled = stats.total - stats.succeeded - stats.failed;
-      return api::Result<GraphRunStats>(stats);
-    }
+std::uint32_t SimpleTaskGraph::PreferPending(RunState* st, std::uint32_t candidate) {
+  // 等待队列中有秩更大的节点时，与之交换：当前线程改为执行它，candidate 进入队列。
+  std::lock_guard<std::mutex> lock(st->mu);
+  if (st->pending.empty() || st->pending.front().first <= st->plan.rank[candidate]) {
+    return candidate;
+  }
+  const std::uint32_t best = st->PopPending();
+  st->PushPending(candidate);
+  return best;
+}
 
-    // 更新 indegree，解锁下一层节点
-    for (std::size_t i = 0; i < level.size(); ++i) {
-      std::map<TaskId, std::set<TaskId> >::const_iterator out = edges_.find(level[i]);
-      if (out == edges_.end()) continue;
-      for (std::set<TaskId>::const_iterator dst = out->second.begin();
-           dst != out->second.end(); ++dst) {
-        std::map<TaskId, std::size_t>::iterator d = indegree.find(*dst);
-        if (d == indegree.end()) {
-          return api::Result<GraphRunStats>(
-              CK_STATUS(api::StatusCode::kInternalError,
-                        "indegree missing for destination node"));
+void SimpleTaskGraph::FinishNode(RunState* st) {
+  if (st->cap != 0) {
+    for (;;) {
+      std::uint32_t next = 0;
+      bool handoff = false;
+      std::size_t dropped = 0;
+      {
+        std::lock_guard<std::mutex> lock(st->mu);
+        if (st->stop.load(std::memory_order_acquire)) {
+          dropped = st->pending.size();
+          st->pending.clear();
+        }
+        if (st->pending.empty()) {
+          --st->running;
+        } else {
+          // 并发额度直接交给下一个等待中的节点（其 active 计数已在 Dispatch 中加上）。
+          next = st->PopPending();
+          handoff = true;
         }
-        if (d->second > 0) --d->second;
-        if (d->second == 0) ready.push(*dst);
       }
+      // 当前节点仍持有自己的计数，这里不会归零。
+      if (dropped != 0) ReleaseActive(st, dropped);
+      if (!handoff || SubmitNode(st, next)) break;
+      // 提交失败：释放该节点的计数，回到循环归还额度并丢弃其余等待节点。
+      ReleaseActive(st, 1);
     }
   }
+  ReleaseActive(st, 1);
+}
 
-  if (processed != nodes_.size()) {
-    return api::Result<GraphRunStats>(
-        CK_STATUS(api::StatusCode::kInvalidArgument,
-                  "task graph contains cycle or unresolved dependency"));
+void SimpleTaskGraph::ReleaseActive(RunState* st, std::size_t count) {
+  if (st->active.fetch_sub(count, std::memory_order_acq_rel) != count) return;
+  if (st->parent != NULL) {
+    // 派生的子图运行结束：结果并入父动态节点，随后释放自身。
+    RunState* parent = st->parent;
+    const std::uint32_t index = st->parent_index;
+    const bool failed = st->failed.load(std::memory_order_relaxed) != 0 || !st->error.ok() ||
+                        st->stop.load(std::memory_order_relaxed);
+    delete st;
+    if (failed) parent->buffers->child_failed[index].store(1, std::memory_order_relaxed);
+    JoinChild(parent, index);
+    return;
   }
-
-  stats.canceled = stats.total - stats.succeeded - stats.failed;
-  return api::Result<GraphRunStats>(stats);
+  std::lock_guard<std::mutex> lock(st->mu);
+  st->done = true;
+  st->done_cv.notify_all();
 }
 
 #undef CK_STATUS
@@ -1,10 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
-#include <map>
-#include <set>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "corekit/task/i_task_graph.hpp"
@@ -23,31 +24,126 @@ class SimpleTaskGraph : public ITaskGraph {
 
   api::Result<TaskId> AddTask(std::function<void()> fn,
                               const GraphTaskOptions& options) override;
+  api::Result<TaskId> AddConditionTask(std::function<std::uint32_t()> fn,
+                                       const GraphTaskOptions& options) override;
+  api::Result<TaskId> AddDynamicTask(std::function<void(ISubflow&)> fn,
+                                     const GraphTaskOptions& options) override;
+  api::Result<TaskId> AddSubgraph(ITaskGraph* graph, const GraphTaskOptions& options) override;
   api::Status AddDependency(TaskId before_task_id, TaskId after_task_id) override;
   api::Status AddDependencies(TaskId after_task_id,
                               const TaskId* before_task_ids,
                               std::size_t count) override;
   api::Status Validate() const override;
+  api::Status Compile() override;
   api::Status Clear() override;
   api::Result<GraphRunStats> Run() override;
   api::Result<GraphRunStats> RunWithExecutor(IExecutor* executor,
                                               const GraphRunOptions& options) override;
 
  private:
+  enum class NodeKind : std::uint8_t { kStatic, kCondition, kDynamic, kSubgraph };
+
+  // 节点按 TaskId 顺序存放：TaskId = 下标 + 1。
   struct TaskNode {
-    TaskId id;
+    NodeKind kind = NodeKind::kStatic;
     std::function<void()> fn;
+    std::function<std::uint32_t()> condition;
+    std::function<void(ISubflow&)> dynamic;
+    const SimpleTaskGraph* subgraph = NULL;
     GraphTaskOptions options;
     std::string name;
+    // 后继节点下标（已去重，保持添加顺序），仅用于构图；运行时使用 Plan 中的 CSR 数组。
+    std::vector<std::uint32_t> successors;
+  };
+
+  // 展开子图后的平面结构。body[i] 为 NULL 表示子图的入口 / 出口占位节点；
+  // successors[i] 为 (目标, 分支号)，条件节点的出边分支号为其后继序号，其余为 kAlways。
+  struct FlatGraph {
+    std::vector<const TaskNode*> body;
+    std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t> > > successors;
+    std::vector<std::pair<const SimpleTaskGraph*, std::uint64_t> > embedded;
+  };
+
+  struct Plan;
+
+  // 一次运行的逐节点计数。顶层运行复用 Plan 中的一份；动态派生的子图运行各自分配，
+  // 因此同一张已编译图可同时被多个动态节点派生。
+  struct RunBuffers {
+    explicit RunBuffers(std::size_t n);
+    void Reset(const Plan& plan);
+
+    std::unique_ptr<std::atomic<std::uint32_t>[]> remaining;
+    // 是否有被激活的入边（根节点恒为激活）。
+    std::unique_ptr<std::atomic<std::uint8_t>[]> activated;
+    // 动态节点：尚未结束的子工作数 + 1（节点函数本身）。
+    std::unique_ptr<std::atomic<std::uint32_t>[]> joins;
+    std::unique_ptr<std::atomic<std::uint8_t>[]> child_failed;
   };
 
-  api::Status BuildIndegree(std::map<TaskId, std::size_t>* indegree) const;
+  // Compile() 的产物，图结构（含嵌入的子图）变化时作废。
+  //   body 为展开子图后的节点，task_count 为其中非占位节点数；
+  //   edges[edge_begin[i] .. edge_begin[i + 1]) 为节点 i 的后继（CSR），edge_branch 为对应分支号；
+  //   indegree / roots 为初始入度与无前驱节点，order 为一个拓扑序；
+  //   buffers / ready / pending 为运行期复用的计数、就绪队列与等待并发额度的节点堆，
+  //   容量在编译时按节点数分配，每次运行只重置，稳态重复运行不再分配堆内存；
+  //   rank 为上行秩（纳秒），ranked_roots 为按秩降序的 roots，ranks_dirty 时在运行前重算；
+  //   measured_ns 为各节点实测耗时的滑动平均；
+  //   embedded 记录展开时各子图的结构版本，用于发现子图在编译后被修改。
+  struct Plan {
+    std::vector<const TaskNode*> body;
+    std::size_t task_count = 0;
+    std::vector<std::uint32_t> edge_begin;
+    std::vector<std::uint32_t> edges;
+    std::vector<std::uint32_t> edge_branch;
+    std::vector<std::uint32_t> indegree;
+    std::vector<std::uint32_t> roots;
+    std::vector<std::uint32_t> order;
+    std::unique_ptr<RunBuffers> buffers;
+    std::vector<std::uint32_t> ready;
+    std::vector<std::pair<std::uint64_t, std::uint32_t> > pending;
+    std::vector<std::uint64_t> rank;
+    std::vector<std::uint32_t> ranked_roots;
+    std::vector<std::uint64_t> measured_ns;
+    bool ranks_dirty = true;
+    std::vector<std::pair<const SimpleTaskGraph*, std::uint64_t> > embedded;
+  };
+  struct RunState;
+  class Subflow;
+
+  void Invalidate() {
+    compiled_ = false;
+    ++version_;
+  }
+  bool EmbeddedStale() const;
+  api::Status Expand(FlatGraph* flat, std::vector<const SimpleTaskGraph*>* stack,
+                     std::vector<std::uint32_t>* entry, std::vector<std::uint32_t>* exit) const;
+  api::Status Flatten(FlatGraph* flat) const;
+  static bool TopologicalOrder(const FlatGraph& flat, std::vector<std::uint32_t>* order);
+  std::uint64_t NodeCost(std::uint32_t index) const;
+  void ComputeRanks();
   api::Result<GraphRunStats> RunInternal(IExecutor* executor,
                                          const GraphRunOptions& options);
+  api::Result<GraphRunStats> RunInline(const GraphRunOptions& options);
+  api::Result<GraphRunStats> RunDataflow(IExecutor* executor, const GraphRunOptions& options);
+
+  static void RunNode(RunState* st, std::uint32_t index);
+  static void Visit(RunState* st, std::uint32_t index, std::uint32_t* next, std::uint32_t depth);
+  static void ReleaseSuccessors(RunState* st, std::uint32_t index, bool ran,
+                                std::uint32_t selected, std::uint32_t* next, std::uint32_t depth);
+  static void CompleteDynamic(RunState* st, std::uint32_t index, std::uint32_t* next);
+  static void JoinChild(RunState* st, std::uint32_t index);
+  static void StartNested(RunState* parent, std::uint32_t index, SimpleTaskGraph* graph);
+  static void Dispatch(RunState* st, std::uint32_t index);
+  static bool SubmitNode(RunState* st, std::uint32_t index);
+  static std::uint32_t PreferPending(RunState* st, std::uint32_t candidate);
+  static void FinishNode(RunState* st);
+  static void ReleaseActive(RunState* st, std::size_t count);
 
-  std::map<TaskId, TaskNode> nodes_;
-  std::map<TaskId, std::set<TaskId> > edges_;
-  TaskId next_id_;
+  std::vector<TaskNode> nodes_;
+  Plan plan_;
+  bool compiled_;
+  // 结构版本：每次结构变化递增，嵌入本图的父图据此判断编译结果是否过期。
+  std::uint64_t version_;
 };
 
 }  // namespace task
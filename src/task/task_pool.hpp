@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TaskPool
+//
+// 执行器内部使用的对象池：按块（kChunkSize 个对象）增长、只增不减，
+// 空闲对象通过带版本号的无锁 Treiber 栈回收（版本号防 ABA）。
+// 稳态下 Acquire/Release 不触发堆分配；池容量耗尽（kMaxChunks 块）时退化为单独 new/delete。
+//
+// T 需提供以下字段（由池维护，使用方不得修改）：
+//   std::uint32_t              pool_index;
+//   std::atomic<std::uint32_t> pool_next;
+// 对象在池中被复用，不会重新构造；使用方在 Release 前自行复位对象状态。
+// ─────────────────────────────────────────────────────────────────────────────
+template <typename T>
+class TaskPool {
+ public:
+  static const std::uint32_t kChunkShift = 8;
+  static const std::uint32_t kChunkSize = 1u << kChunkShift;
+  static const std::uint32_t kMaxChunks = 4096;
+  static const std::uint32_t kHeapIndex = 0xFFFFFFFFu;
+
+  TaskPool() : free_head_(0), chunk_count_(0) {
+    for (std::uint32_t i = 0; i < kMaxChunks; ++i) chunks_[i].store(NULL);
+  }
+
+  ~TaskPool() {
+    for (std::uint32_t i = 0; i < chunk_count_; ++i) delete[] chunks_[i].load();
+  }
+
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+
+  T* Acquire() {
+    for (;;) {
+      std::uint64_t head = free_head_.load(std::memory_order_acquire);
+      while (static_cast<std::uint32_t>(head) != 0) {
+        T* obj = At(static_cast<std::uint32_t>(head) - 1);
+        const std::uint32_t next = obj->pool_next.load(std::memory_order_relaxed);
+        const std::uint64_t desired = NextTag(head) | next;
+        if (free_head_.compare_exchange_weak(head, desired, std::memory_order_acquire,
+                                             std::memory_order_acquire)) {
+          return obj;
+        }
+      }
+      T* grown = Grow();
+      if (grown != NULL) return grown;
+    }
+  }
+
+  void Release(T* obj) {
+    if (obj->pool_index == kHeapIndex) {
+      delete obj;
+      return;
+    }
+    PushChain(obj, obj);
+  }
+
+ private:
+  static std::uint64_t NextTag(std::uint64_t head) {
+    return ((head >> 32) + 1) << 32;
+  }
+
+  T* At(std::uint32_t index) const {
+    T* chunk = chunks_[index >> kChunkShift].load(std::memory_order_acquire);
+    return &chunk[index & (kChunkSize - 1)];
+  }
+
+  // 将 first..last（已通过 pool_next 串好）整体压入空闲栈。
+  void PushChain(T* first, T* last) {
+    std::uint64_t head = free_head_.load(std::memory_order_relaxed);
+    std::uint64_t desired = 0;
+    do {
+      last->pool_next.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+      desired = NextTag(head) | (first->pool_index + 1);
+    } while (!free_head_.compare_exchange_weak(head, desired, std::memory_order_release,
+                                               std::memory_order_relaxed));
+  }
+
+  // 新增一块对象：返回其中一个，其余压入空闲栈。
+  // 返回 NULL 表示其他线程已完成扩容，调用方应重试出栈。
+  T* Grow() {
+    std::lock_guard<std::mutex> lock(grow_mu_);
+    if (static_cast<std::uint32_t>(free_head_.load(std::memory_order_acquire)) != 0) return NULL;
+    if (chunk_count_ >= kMaxChunks) {
+      T* obj = new T();
+      obj->pool_index = kHeapIndex;
+      return obj;
+    }
+
+    const std::uint32_t base = chunk_count_ << kChunkShift;
+    T* chunk = new T[kChunkSize];
+    for (std::uint32_t i = 0; i < kChunkSize; ++i) {
+      chunk[i].pool_index = base + i;
+      const std::uint32_t next = (i + 1 < kChunkSize) ? base + i + 2 : 0;
+      chunk[i].pool_next.store(next, std::memory_order_relaxed);
+    }
+    chunks_[chunk_count_].store(chunk, std::memory_order_release);
+    ++chunk_count_;
+    if (kChunkSize > 1) PushChain(&chunk[1], &chunk[kChunkSize - 1]);
+    return &chunk[0];
+  }
+
+  std::atomic<std::uint64_t> free_head_;  // 高 32 位：版本号；低 32 位：对象下标 + 1（0 = 空）
+  std::mutex grow_mu_;
+  std::uint32_t chunk_count_;
+  std::atomic<T*> chunks_[kMaxChunks];
+};
+
+}  // namespace task
+}  // namespace corekit
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "corekit/task/iexecutor.hpp"
+#include "task/futex_wait.hpp"
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TaskSlotTable
+//
+// 以 "槽位 + 代数" 编码 TaskId 的任务状态表：
+//   TaskId = (generation << 32) | (slot_index + 1)
+// 每个槽位只有一个 64 位原子状态字（高 32 位代数，低 32 位状态/标志），
+// 状态迁移（Pending → Running → Done、Pending → Canceled）全部通过 CAS 完成，
+// 因此查询/等待/取消都是无锁的。代数不匹配即表示该 ID 已过期（kNotFound）。
+//
+// 等待：等待方先自旋 kSpinCount 次，再在槽位自己的 epoch 字上 futex 休眠，并置
+// kWaiterFlag；完成方仅在看到该标志时才递增 epoch 并唤醒，无等待者时完成路径不做系统调用。
+// 批量等待通过 WaitLatch（单个倒计数字）挂到各槽位，由完成方倒计数，等待方只休眠一次。
+//
+// 内存上界：已完成槽位进入 "退役" FIFO，最多保留 max_retained 个供结果查询；
+// 超出后最老的槽位被复用（代数 +1）。槽位按块增长、地址稳定，分配/退役
+// 仅在短临界区 list_mu_ 内维护链表，不涉及执行器全局锁。
+// ─────────────────────────────────────────────────────────────────────────────
+class TaskSlotTable {
+ public:
+  // 状态字低 32 位布局。
+  static const std::uint32_t kStateMask = 0x0F;
+  static const std::uint32_t kFree = 0;
+  static const std::uint32_t kPending = 1;
+  static const std::uint32_t kRunning = 2;
+  static const std::uint32_t kDone = 3;
+  static const std::uint32_t kCanceledFlag = 0x10;
+  static const std::uint32_t kSucceededFlag = 0x20;
+  static const std::uint32_t kWaiterFlag = 0x40;
+
+  static const int kSpinCount = 128;
+
+  typedef std::chrono::steady_clock::time_point Deadline;
+
+  // 批量等待的倒计数闩：remaining 归零时唤醒等待方。
+  struct WaitLatch {
+    WaitLatch() : remaining(1) {}  // 初始 1 为登记期间的哨兵计数
+    std::atomic<std::uint32_t> remaining;
+
+    void CountDown() {
+      if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) FutexWakeAll(&remaining);
+    }
+  };
+
+  static const std::uint32_t kChunkShift = 12;
+  static const std::uint32_t kChunkSize = 1u << kChunkShift;
+  static const std::uint32_t kMaxChunks = 4096;
+
+  explicit TaskSlotTable(std::size_t max_retained)
+      : max_retained_(max_retained),
+        chunk_count_(0),
+        free_head_(0),
+        retired_head_(0),
+        retired_tail_(0),
+        retired_count_(0) {
+    for (std::uint32_t i = 0; i < kMaxChunks; ++i) chunks_[i].store(NULL);
+  }
+
+  ~TaskSlotTable() {
+    for (std::uint32_t i = 0; i < chunk_count_; ++i) delete[] chunks_[i].load();
+  }
+
+  TaskSlotTable(const TaskSlotTable&) = delete;
+  TaskSlotTable& operator=(const TaskSlotTable&) = delete;
+
+  // 分配一个处于 Pending 状态的槽位并返回其 TaskId；槽位耗尽时返回 0。
+  TaskId Allocate() {
+    std::lock_guard<std::mutex> lock(list_mu_);
+    return AllocateLocked();
+  }
+
+  // 在一次加锁内分配 count 个槽位写入 out；槽位不足时撤销已分配的部分并返回 false。
+  bool AllocateBatch(TaskId* out, std::size_t count) {
+    std::lock_guard<std::mutex> lock(list_mu_);
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = AllocateLocked();
+      if (out[i] == 0) {
+        while (i > 0) AbandonLocked(out[--i]);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // 撤销一次未入队成功的分配：槽位直接回到空闲链表（代数 +1 使旧 ID 失效）。
+  void Abandon(TaskId id) {
+    if (Find(id) == NULL) return;
+    std::lock_guard<std::mutex> lock(list_mu_);
+    AbandonLocked(id);
+  }
+
+  // 读取 ID 对应的状态位；ID 未知或已过期时返回 false。
+  bool Load(TaskId id, std::uint32_t* bits) const {
+    const Slot* slot = Find(id);
+    if (slot == NULL) return false;
+    const std::uint64_t word = slot->word.load(std::memory_order_acquire);
+    if (Generation(word) != static_cast<std::uint32_t>(id >> 32)) return false;
+    const std::uint32_t b = static_cast<std::uint32_t>(word);
+    if ((b & kStateMask) == kFree) return false;
+    *bits = b;
+    return true;
+  }
+
+  // Pending → Running。任务已被取消时返回 false（调用方应以取消状态完成该任务）。
+  bool TryStart(TaskId id) {
+    Slot* slot = Find(id);
+    if (slot == NULL) return false;
+    const std::uint32_t gen = static_cast<std::uint32_t>(id >> 32);
+    std::uint64_t word = slot->word.load(std::memory_order_acquire);
+    for (;;) {
+      const std::uint32_t bits = static_cast<std::uint32_t>(word);
+      if (Generation(word) != gen || (bits & kStateMask) != kPending ||
+          (bits & kCanceledFlag) != 0) {
+        return false;
+      }
+      const std::uint64_t next = (word & ~static_cast<std::uint64_t>(kStateMask)) | kRunning;
+      if (slot->word.compare_exchange_weak(word, next, std::memory_order_acq_rel)) return true;
+    }
+  }
+
+  // 对尚未开始的任务置取消标志。
+  // 返回：kOk = 成功（含重复取消）；kWouldBlock = 已在运行或已完成；kNotFound = ID 未知。
+  api::StatusCode TryCancel(TaskId id, bool* newly_canceled) {
+    *newly_canceled = false;
+    Slot* slot = Find(id);
+    if (slot == NULL) return api::StatusCode::kNotFound;
+    const std::uint32_t gen = static_cast<std::uint32_t>(id >> 32);
+    std::uint64_t word = slot->word.load(std::memory_order_acquire);
+    for (;;) {
+      if (Generation(word) != gen || (static_cast<std::uint32_t>(word) & kStateMask) == kFree) {
+        return api::StatusCode::kNotFound;
+      }
+      const std::uint32_t bits = static_cast<std::uint32_t>(word);
+      if ((bits & kStateMask) != kPending) return api::StatusCode::kWouldBlock;
+      if ((bits & kCanceledFlag) != 0) return api::StatusCode::kOk;
+      if (slot->word.compare_exchange_weak(word, word | kCanceledFlag,
+                                           std::memory_order_acq_rel)) {
+        *newly_canceled = true;
+        return api::StatusCode::kOk;
+      }
+    }
+  }
+
+  // 置为 Done（保留取消标志，按需附加成功标志），唤醒等待方并退役该槽位。
+  void Finish(TaskId id, bool succeeded) {
+    Slot* slot = Find(id);
+    if (slot == NULL) return;
+    const std::uint32_t gen = static_cast<std::uint32_t>(id >> 32);
+    std::uint64_t word = slot->word.load(std::memory_order_relaxed);
+    std::uint64_t next = 0;
+    do {
+      std::uint32_t bits = kDone | (static_cast<std::uint32_t>(word) & kCanceledFlag);
+      if (succeeded) bits |= kSucceededFlag;
+      next = Pack(gen, bits);
+    } while (!slot->word.compare_exchange_weak(word, next, std::memory_order_acq_rel));
+
+    if ((static_cast<std::uint32_t>(word) & kWaiterFlag) != 0) {
+      WaitLatch* latch = slot->latch.exchange(NULL, std::memory_order_acq_rel);
+      slot->epoch.fetch_add(1, std::memory_order_release);
+      FutexWakeAll(&slot->epoch);
+      if (latch != NULL) latch->CountDown();
+    }
+    Retire(slot, static_cast<std::uint32_t>(id));
+  }
+
+  static bool IsDone(std::uint32_t bits) { return (bits & kStateMask) == kDone; }
+
+  // 等待单个任务结束（或 ID 过期）。到达 deadline 仍未结束时返回 false。
+  bool WaitDone(TaskId id, Deadline deadline) {
+    Slot* slot = Find(id);
+    if (slot == NULL) return true;
+    const std::uint32_t gen = static_cast<std::uint32_t>(id >> 32);
+    for (int i = 0; i < kSpinCount; ++i) {
+      if (Settled(slot->word.load(std::memory_order_acquire), gen)) return true;
+      CpuRelax();
+    }
+    for (;;) {
+      // 先读 epoch 再置等待标志：完成方看到标志后必然递增 epoch，futex 不会错过唤醒。
+      const std::uint32_t epoch = slot->epoch.load(std::memory_order_acquire);
+      if (!MarkWaiter(slot, gen)) return true;
+      const std::int64_t remaining = RemainingNanos(deadline);
+      if (remaining == 0) return false;
+      FutexWait(&slot->epoch, epoch, remaining);
+    }
+  }
+
+  // 等待一批任务全部结束（或过期）。可挂闩的任务共享一个 WaitLatch，等待方只在闩上休眠；
+  // 槽位已被其他批量等待占用的任务退化为逐个 WaitDone。超时返回 false。
+  bool WaitAllDone(const TaskId* ids, std::size_t count, Deadline deadline) {
+    WaitLatch latch;
+    bool need_individual = false;
+    for (std::size_t i = 0; i < count; ++i) {
+      Slot* slot = Find(ids[i]);
+      if (slot == NULL) continue;
+      const std::uint32_t gen = static_cast<std::uint32_t>(ids[i] >> 32);
+      if (Settled(slot->word.load(std::memory_order_acquire), gen)) continue;
+      WaitLatch* expected = NULL;
+      if (!slot->latch.compare_exchange_strong(expected, &latch, std::memory_order_acq_rel)) {
+        need_individual = true;
+        continue;
+      }
+      latch.remaining.fetch_add(1, std::memory_order_relaxed);
+      // 任务已结束：尝试收回闩；收回失败说明完成方已取走，由其负责倒计数。
+      if (!MarkWaiter(slot, gen) && UnregisterLatch(slot, &latch)) latch.CountDown();
+    }
+    latch.CountDown();  // 撤销哨兵计数
+
+    if (!WaitLatchZero(&latch, deadline)) {
+      // 超时：收回仍挂在槽位上的闩，并等待已取走闩的完成方倒计数完毕，之后闩才能出栈。
+      for (std::size_t i = 0; i < count; ++i) {
+        Slot* slot = Find(ids[i]);
+        if (slot != NULL && UnregisterLatch(slot, &latch)) latch.CountDown();
+      }
+      WaitLatchZero(&latch, Deadline::max());
+      return false;
+    }
+    if (need_individual) {
+      for (std::size_t i = 0; i < count; ++i) {
+        if (!WaitDone(ids[i], deadline)) return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  struct Slot {
+    Slot() : word(0), epoch(0), latch(NULL), next(0) {}
+    std::atomic<std::uint64_t> word;   // 高 32 位：代数；低 32 位：状态 | 标志
+    std::atomic<std::uint32_t> epoch;  // futex 字：完成时递增
+    std::atomic<WaitLatch*> latch;     // 挂在该槽位上的批量等待闩
+    std::uint32_t next;                // 空闲/退役链表（槽位下标 + 1），受 list_mu_ 保护
+  };
+
+  // 该代任务已结束、或槽位已被回收/复用。
+  static bool Settled(std::uint64_t word, std::uint32_t gen) {
+    const std::uint32_t state = static_cast<std::uint32_t>(word) & kStateMask;
+    return Generation(word) != gen || state == kDone || state == kFree;
+  }
+
+  // 为未结束的任务置等待标志（即使已置位也执行一次 CAS，以发布随后读取的闩指针）。
+  // 任务已结束或已过期时返回 false。
+  static bool MarkWaiter(Slot* slot, std::uint32_t gen) {
+    std::uint64_t word = slot->word.load(std::memory_order_acquire);
+    for (;;) {
+      if (Settled(word, gen)) return false;
+      if (slot->word.compare_exchange_weak(word, word | kWaiterFlag,
+                                           std::memory_order_acq_rel)) {
+        return true;
+      }
+    }
+  }
+
+  static bool UnregisterLatch(Slot* slot, WaitLatch* latch) {
+    WaitLatch* expected = latch;
+    return slot->latch.compare_exchange_strong(expected, NULL, std::memory_order_acq_rel);
+  }
+
+  static bool WaitLatchZero(WaitLatch* latch, Deadline deadline) {
+    for (int i = 0; i < kSpinCount; ++i) {
+      if (latch->remaining.load(std::memory_order_acquire) == 0) return true;
+      CpuRelax();
+    }
+    for (;;) {
+      const std::uint32_t remaining = latch->remaining.load(std::memory_order_acquire);
+      if (remaining == 0) return true;
+      const std::int64_t timeout = RemainingNanos(deadline);
+      if (timeout == 0) return false;
+      FutexWait(&latch->remaining, remaining, timeout);
+    }
+  }
+
+  TaskId AllocateLocked() {
+    std::uint32_t link = 0;
+    if (free_head_ != 0) {
+      link = free_head_;
+      free_head_ = SlotAt(link - 1).next;
+    } else if (retired_count_ > max_retained_ || (retired_count_ > 0 && !CanGrowLocked())) {
+      link = retired_head_;
+      retired_head_ = SlotAt(link - 1).next;
+      if (retired_head_ == 0) retired_tail_ = 0;
+      --retired_count_;
+    } else if (CanGrowLocked()) {
+      link = GrowLocked();
+    } else {
+      return 0;
+    }
+
+    Slot& slot = SlotAt(link - 1);
+    slot.next = 0;
+    const std::uint32_t gen = Generation(slot.word.load(std::memory_order_relaxed)) + 1;
+    slot.word.store(Pack(gen, kPending), std::memory_order_release);
+    return (static_cast<TaskId>(gen) << 32) | link;
+  }
+
+  void AbandonLocked(TaskId id) {
+    Slot* slot = Find(id);
+    slot->word.store(Pack(static_cast<std::uint32_t>(id >> 32), kFree),
+                     std::memory_order_release);
+    slot->next = free_head_;
+    free_head_ = static_cast<std::uint32_t>(id);
+  }
+
+  void Retire(Slot* slot, std::uint32_t link) {
+    std::lock_guard<std::mutex> lock(list_mu_);
+    slot->next = 0;
+    if (retired_tail_ == 0) {
+      retired_head_ = link;
+    } else {
+      SlotAt(retired_tail_ - 1).next = link;
+    }
+    retired_tail_ = link;
+    ++retired_count_;
+  }
+
+  static std::uint64_t Pack(std::uint32_t gen, std::uint32_t bits) {
+    return (static_cast<std::uint64_t>(gen) << 32) | bits;
+  }
+  static std::uint32_t Generation(std::uint64_t word) {
+    return static_cast<std::uint32_t>(word >> 32);
+  }
+
+  Slot& SlotAt(std::uint32_t index) const {
+    Slot* chunk = chunks_[index >> kChunkShift].load(std::memory_order_acquire);
+    return chunk[index & (kChunkSize - 1)];
+  }
+
+  Slot* Find(TaskId id) const {
+    const std::uint32_t link = static_cast<std::uint32_t>(id);
+    if (link == 0) return NULL;
+    const std::uint32_t index = link - 1;
+    if ((index >> kChunkShift) >= kMaxChunks) return NULL;
+    Slot* chunk = chunks_[index >> kChunkShift].load(std::memory_order_acquire);
+    if (chunk == NULL) return NULL;
+    return &chunk[index & (kChunkSize - 1)];
+  }
+
+  bool CanGrowLocked() const { return chunk_count_ < kMaxChunks; }
+
+  // 新增一块槽位，返回其中第一个的链接值，其余压入空闲链表。
+  std::uint32_t GrowLocked() {
+    const std::uint32_t base = chunk_count_ << kChunkShift;
+    Slot* chunk = new Slot[kChunkSize];
+    for (std::uint32_t i = 1; i < kChunkSize; ++i) {
+      chunk[i].next = (i + 1 < kChunkSize) ? base + i + 2 : free_head_;
+    }
+    chunks_[chunk_count_].store(chunk, std::memory_order_release);
+    ++chunk_count_;
+    free_head_ = base + 2;
+    return base + 1;
+  }
+
+  const std::size_t max_retained_;
+  std::mutex list_mu_;
+  std::uint32_t chunk_count_;
+  std::uint32_t free_head_;
+  std::uint32_t retired_head_;
+  std::uint32_t retired_tail_;
+  std::size_t retired_count_;
+  std::atomic<Slot*> chunks_[kMaxChunks];
+};
+
+}  // namespace task
+}  // namespace corekit
@@ -3,126 +3,741 @@
 #include <algorithm>
 #include <chrono>
 #include <exception>
+#include <limits>
+#include <thread>
 
 #include "corekit/api/version.hpp"
+#include "task/futex_wait.hpp"
 
 namespace corekit {
 namespace task {
 
 #define CK_STATUS(code, message) api::Status::FromModule((code), (message), api::ErrorModule::kTask)
 
-ThreadPoolExecutor::ThreadPoolExecutor(std::size_t worker_count)
-    : stopping_(false),
-      active_workers_(0),
-      pending_tasks_(0),
-      next_task_id_(1),
-      enqueue_seq_(0),
-      max_retained_states_(65536) {
-  options_.worker_count = NormalizeWorkerCount(worker_count);
-  options_.policy = ExecutorPolicy::kHybridFairPriority;
-  workers_.reserve(options_.worker_count);
-  for (std::size_t i = 0; i < options_.worker_count; ++i) {
-    workers_.push_back(std::thread(&ThreadPoolExecutor::WorkerLoop, this));
-  }
+namespace {
+
+ExecutorOptions OptionsWithWorkers(std::size_t worker_count) {
+  ExecutorOptions options;
+  options.worker_count = worker_count;
+  return options;
+}
+
+std::uint64_t SteadyNanos() {
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        std::chrono::steady_clock::now().time_since_epoch())
+                                        .count());
 }
 
+// 一次 ParallelForRange 调用的共享状态。调用线程与辅助任务通过原子游标领取分块；
+// 以 shared_ptr 持有，排队较晚的辅助任务在区间已处理完后仍可安全访问并直接退出。
+struct ParallelForJob {
+  std::function<void(std::size_t, std::size_t)> fn;
+  std::size_t end = 0;
+  std::size_t total = 0;
+  std::size_t grain = 0;       // > 0：固定分块
+  std::size_t min_chunk = 1;   // 自适应分块下限
+  std::size_t participants = 1;
+  std::atomic<std::size_t> cursor{0};
+  std::atomic<std::size_t> done{0};
+  std::atomic<std::uint32_t> finished{0};
+  std::atomic<bool> failed{false};
+
+  bool Grab(std::size_t* chunk_begin, std::size_t* chunk_end) {
+    std::size_t cur = cursor.load(std::memory_order_relaxed);
+    for (;;) {
+      if (cur >= end) return false;
+      const std::size_t remaining = end - cur;
+      std::size_t chunk = grain;
+      if (chunk == 0) chunk = std::max(min_chunk, remaining / (2 * participants));
+      chunk = std::min(chunk, remaining);
+      if (cursor.compare_exchange_weak(cur, cur + chunk, std::memory_order_relaxed)) {
+        *chunk_begin = cur;
+        *chunk_end = cur + chunk;
+        return true;
+      }
+    }
+  }
+
+  void Run() {
+    std::size_t b = 0;
+    std::size_t e = 0;
+    while (Grab(&b, &e)) {
+      try {
+        fn(b, e);
+      } catch (...) {
+        failed.store(true, std::memory_order_relaxed);
+      }
+      if (done.fetch_add(e - b, std::memory_order_acq_rel) + (e - b) == total) {
+        finished.store(1, std::memory_order_release);
+        FutexWakeAll(&finished);
+      }
+    }
+  }
+
+  void WaitFinished() {
+    for (int i = 0; i < 256; ++i) {
+      if (finished.load(std::memory_order_acquire) != 0) return;
+      CpuRelax();
+    }
+    while (finished.load(std::memory_order_acquire) == 0) FutexWait(&finished, 0, -1);
+  }
+};
+
+}  // namespace
+
+const std::size_t ThreadPoolExecutor::kMaxWorkers;
+const std::size_t ThreadPoolExecutor::kInjectBatch;
+
+ThreadPoolExecutor::ThreadPoolExecutor(std::size_t worker_count)
+    : ThreadPoolExecutor(OptionsWithWorkers(worker_count)) {}
+
 ThreadPoolExecutor::ThreadPoolExecutor(const ExecutorOptions& options)
-    : ThreadPoolExecutor(options.worker_count) {
-  options_.queue_capacity = options.queue_capacity;
-  options_.policy = options.policy;
+    : workers_(new WorkerSlot[kMaxWorkers]),
+      worker_slot_count_(0),
+      live_workers_(0),
+      spawn_limit_(0),
+      spawn_queue_depth_(0),
+      stopping_(false),
+      sleeping_workers_(0),
+      spinning_workers_(0),
+      ready_count_(0),
+      pending_tasks_(0),
+      queued_tasks_(0),
+      queue_capacity_(options.queue_capacity),
+      overflow_policy_(options.overflow_policy),
+      block_timeout_ms_(options.block_timeout_ms),
+      blocked_submitters_(0),
+      latency_enabled_(options.enable_latency_stats),
+      options_(options),
+      slots_(kMaxRetainedStates),
+      timer_epoch_(std::chrono::steady_clock::now()),
+      timer_stopping_(false),
+      timer_wake_tick_(0),
+      timer_count_(0),
+      timer_wheel_(0) {
+  if (options_.affinity != AffinityPolicy::kNone || options_.cpu_count > 0) {
+    std::vector<std::uint32_t> allowed;
+    if (options.cpus != NULL) allowed.assign(options.cpus, options.cpus + options.cpu_count);
+    topology_ = CpuTopology::Detect().Restrict(allowed);
+  }
+  policy_.store(options.policy, std::memory_order_relaxed);
+  // cpus 由调用方持有，仅在此处读取。
+  options_.cpus = NULL;
+  options_.cpu_count = 0;
+  if (options_.affinity != AffinityPolicy::kNone) {
+    const std::size_t node_count = std::max<std::size_t>(1, topology_.nodes.size());
+    for (std::size_t n = 0; n < node_count; ++n) {
+      node_ready_.push_back(std::unique_ptr<ReadyQueue<TaskEntry> >(new ReadyQueue<TaskEntry>()));
+    }
+  }
+  for (std::size_t i = 0; i < 3; ++i) {
+    rate_limiters_[i].Configure(options.rate_limit_per_sec[i], options.rate_burst[i]);
+  }
+  if (options_.backend == ExecutorBackend::kWorkStealing) {
+    inject_.reset(new MpmcQueue<TaskEntry*>[kInjectLanes]);
+  }
+  std::lock_guard<std::mutex> lock(mu_);
+  ApplyScalingLocked(options);
 }
 
 ThreadPoolExecutor::~ThreadPoolExecutor() {
+  StopTimers();
   {
     std::lock_guard<std::mutex> lock(mu_);
-    stopping_ = true;
+    stopping_.store(true);
   }
   cv_.notify_all();
-  for (std::size_t i = 0; i < workers_.size(); ++i) {
-    if (workers_[i].joinable()) workers_[i].join();
+  NotifySpace();
+  const std::size_t slot_count = worker_slot_count_.load();
+  for (std::size_t i = 0; i < slot_count; ++i) {
+    if (workers_[i].thread.joinable()) workers_[i].thread.join();
+  }
+  // 全部线程退出后再释放上下文：其他线程在退出前仍可能遍历所有上下文。
+  for (std::size_t i = 0; i < slot_count; ++i) {
+    delete workers_[i].ctx.load();
+    delete workers_[i].latency.load();
+  }
+  // 工作线程退出前会清空注入队列；这里只兜底处理与关闭并发的外部提交。
+  for (std::size_t i = 0; inject_ && i < kInjectLanes; ++i) {
+    TaskEntry* entry = NULL;
+    while (inject_[i].TryPop(&entry)) DropAccepted(entry);
   }
 }
 
-const char* ThreadPoolExecutor::Name() const { return "corekit.task.thread_pool_executor"; }
+const char* ThreadPoolExecutor::Name() const {
+  return options_.backend == ExecutorBackend::kWorkStealing
+             ? "corekit.task.work_stealing_executor"
+             : "corekit.task.thread_pool_executor";
+}
 std::uint32_t ThreadPoolExecutor::ApiVersion() const { return api::kApiVersion; }
 void ThreadPoolExecutor::Release() { delete this; }
 
 std::size_t ThreadPoolExecutor::NormalizeWorkerCount(std::size_t worker_count) const {
-  if (worker_count > 0) return worker_count;
+  if (worker_count > 0) return std::min(worker_count, kMaxWorkers);
   std::size_t count = static_cast<std::size_t>(std::thread::hardware_concurrency());
-  return count == 0 ? 1 : count;
+  return count == 0 ? 1 : std::min(count, kMaxWorkers);
+}
+
+void ThreadPoolExecutor::ApplyScalingLocked(const ExecutorOptions& options) {
+  options_.worker_count = NormalizeWorkerCount(options.worker_count);
+  options_.max_workers = std::min(options.max_workers, kMaxWorkers);
+  options_.min_workers = std::min(options.min_workers, options_.max_workers);
+  options_.idle_timeout_ms = options.idle_timeout_ms;
+  options_.spawn_queue_depth = options.spawn_queue_depth;
+  if (options_.max_workers > 0) {
+    options_.worker_count =
+        std::max(options_.min_workers, std::min(options_.worker_count, options_.max_workers));
+  }
+  spawn_limit_.store(options_.max_workers, std::memory_order_relaxed);
+  spawn_queue_depth_.store(options_.spawn_queue_depth, std::memory_order_relaxed);
+
+  while (live_workers_.load() < options_.worker_count && SpawnWorkerLocked()) {
+  }
+  // 多余的线程在没有可执行任务时自行退出（见 AcquireTask）。
+  cv_.notify_all();
+}
+
+bool ThreadPoolExecutor::SpawnWorkerLocked() {
+  if (stopping_.load()) return false;
+  std::size_t index = 0;
+  while (index < kMaxWorkers && workers_[index].running) ++index;
+  if (index == kMaxWorkers) return false;
+
+  WorkerSlot& slot = workers_[index];
+  // 槽位上次的线程已退役（running = false 后不再访问 mu_），join 不会阻塞在锁上。
+  if (slot.thread.joinable()) slot.thread.join();
+  PlaceWorker(index, &slot.node, &slot.cpus);
+  if (options_.backend == ExecutorBackend::kWorkStealing && slot.ctx.load() == NULL) {
+    WorkerContext* ctx = new WorkerContext();
+    ctx->owner = this;
+    ctx->node = slot.node;
+    ctx->rng = 0x9E3779B97F4A7C15ULL * (index + 1);
+    slot.ctx.store(ctx, std::memory_order_release);
+  }
+  slot.running = true;
+  live_workers_.fetch_add(1);
+  if (index + 1 > worker_slot_count_.load()) {
+    worker_slot_count_.store(index + 1, std::memory_order_release);
+  }
+  try {
+    slot.thread = std::thread(&ThreadPoolExecutor::WorkerLoop, this, index);
+  } catch (...) {
+    slot.running = false;
+    live_workers_.fetch_sub(1);
+    return false;
+  }
+  return true;
+}
+
+void ThreadPoolExecutor::MaybeSpawnWorker() {
+  // 热路径仅做原子读：固定线程池、积压未超过阈值或休眠线程足以接走积压时直接返回。
+  // 休眠计数包含已被唤醒但尚未醒来的线程，因此只在它不少于积压时才放弃扩容。
+  const std::size_t limit = spawn_limit_.load(std::memory_order_relaxed);
+  if (limit == 0) return;
+  const std::size_t live = live_workers_.load(std::memory_order_relaxed);
+  if (live >= limit) return;
+  if (live > 0) {
+    const std::size_t queued = queued_tasks_.load(std::memory_order_relaxed);
+    if (queued <= spawn_queue_depth_.load(std::memory_order_relaxed)) return;
+    if (sleeping_workers_.load(std::memory_order_relaxed) >= queued) return;
+  }
+  std::lock_guard<std::mutex> lock(mu_);
+  if (live_workers_.load() < options_.max_workers) SpawnWorkerLocked();
+}
+
+void ThreadPoolExecutor::RetireWorkerLocked(std::size_t index) {
+  workers_[index].running = false;
+  live_workers_.fetch_sub(1);
+}
+
+void ThreadPoolExecutor::PlaceWorker(std::size_t index, std::int32_t* node,
+                                     std::vector<std::uint32_t>* cpus) const {
+  *node = -1;
+  cpus->clear();
+  const std::vector<std::vector<std::uint32_t> >& nodes = topology_.nodes;
+  if (nodes.empty()) return;
+  const std::size_t node_count = nodes.size();
+
+  switch (options_.affinity) {
+    case AffinityPolicy::kNone:
+      // 仅限制在 cpus 指定的集合内，不逐线程绑定。
+      for (std::size_t n = 0; n < node_count; ++n) {
+        cpus->insert(cpus->end(), nodes[n].begin(), nodes[n].end());
+      }
+      return;
+    case AffinityPolicy::kCompact: {
+      std::size_t k = index % topology_.CpuCount();
+      std::size_t n = 0;
+      while (k >= nodes[n].size()) k -= nodes[n++].size();
+      *node = static_cast<std::int32_t>(n);
+      cpus->push_back(nodes[n][k]);
+      return;
+    }
+    case AffinityPolicy::kScatter: {
+      const std::size_t n = index % node_count;
+      *node = static_cast<std::int32_t>(n);
+      cpus->push_back(nodes[n][(index / node_count) % nodes[n].size()]);
+      return;
+    }
+    case AffinityPolicy::kPerNode: {
+      const std::size_t n = index % node_count;
+      *node = static_cast<std::int32_t>(n);
+      *cpus = nodes[n];
+      return;
+    }
+  }
+}
+
+ThreadPoolExecutor::TaskEntry* ThreadPoolExecutor::PopReadyLocked(std::int32_t node) {
+  // 顺序：本节点队列 → 全局队列 → 其他节点队列（保证工作守恒，节点只是偏好）。
+  const std::size_t node_count = node_ready_.size();
+  TaskEntry* entry = NULL;
+  if (node >= 0 && static_cast<std::size_t>(node) < node_count) {
+    entry = node_ready_[node]->Pop(options_.policy, options_.aging_threshold);
+  }
+  if (entry == NULL) entry = ready_.Pop(options_.policy, options_.aging_threshold);
+  const std::size_t start = node >= 0 ? static_cast<std::size_t>(node) + 1 : 0;
+  for (std::size_t i = 0; entry == NULL && i < node_count; ++i) {
+    entry = node_ready_[(start + i) % node_count]->Pop(options_.policy,
+                                                       options_.aging_threshold);
+  }
+  if (entry != NULL) ready_count_.fetch_sub(1, std::memory_order_relaxed);
+  return entry;
+}
+
+bool ThreadPoolExecutor::ReadyEmptyLocked() const {
+  if (!ready_.Empty()) return false;
+  for (std::size_t i = 0; i < node_ready_.size(); ++i) {
+    if (!node_ready_[i]->Empty()) return false;
+  }
+  return true;
+}
+
+OverflowPolicy ThreadPoolExecutor::SubmitPolicy(bool serial) const {
+  const OverflowPolicy policy = overflow_policy_.load(std::memory_order_relaxed);
+  // 工作线程阻塞等待队列空位可能等的正是自己：不阻塞。串行任务不能越过键队列内联执行。
+  if (policy == OverflowPolicy::kBlock && CurrentPoolSlot() == this) return OverflowPolicy::kReject;
+  if (policy == OverflowPolicy::kCallerRuns && serial) return OverflowPolicy::kReject;
+  return policy;
+}
+
+api::Status ThreadPoolExecutor::Admit(std::size_t count, TaskPriority priority,
+                                      OverflowPolicy policy) {
+  if (stopping_.load(std::memory_order_acquire)) {
+    return CK_STATUS(api::StatusCode::kInternalError,
+                     "executor is stopping, cannot accept new tasks");
+  }
+  std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+  if (policy == OverflowPolicy::kBlock) {
+    const std::uint32_t timeout_ms = block_timeout_ms_.load(std::memory_order_relaxed);
+    if (timeout_ms > 0) {
+      deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    }
+  }
+  api::Status st = Throttle(count, priority, policy, deadline);
+  if (!st.ok()) return st;
+
+  for (;;) {
+    const std::size_t capacity = queue_capacity_.load(std::memory_order_relaxed);
+    const std::size_t depth = queued_tasks_.fetch_add(count) + count;
+    if (capacity == 0 || depth <= capacity) {
+      NoteQueueDepth(depth);
+      return api::Status::Ok();
+    }
+    queued_tasks_.fetch_sub(count);
+    if (policy == OverflowPolicy::kDropOldestLowPriority &&
+        EvictQueued(priority, depth - capacity) > 0) {
+      continue;
+    }
+    if (policy == OverflowPolicy::kBlock && WaitForCapacity(count, deadline)) continue;
+    break;
+  }
+  if (stopping_.load(std::memory_order_acquire)) {
+    return CK_STATUS(api::StatusCode::kInternalError,
+                     "executor is stopping, cannot accept new tasks");
+  }
+  // kCallerRuns 的任务随后由提交线程执行，不算拒绝。
+  if (policy != OverflowPolicy::kCallerRuns) {
+    stats_.rejected.fetch_add(count, std::memory_order_relaxed);
+  }
+  return CK_STATUS(api::StatusCode::kWouldBlock, "executor queue is full");
+}
+
+api::Status ThreadPoolExecutor::Throttle(std::size_t count, TaskPriority priority,
+                                         OverflowPolicy policy,
+                                         std::chrono::steady_clock::time_point deadline) {
+  RateLimiter& limiter =
+      rate_limiters_[std::min<std::size_t>(static_cast<std::size_t>(priority), 2)];
+  if (!limiter.Enabled()) return api::Status::Ok();
+  bool counted = false;
+  for (;;) {
+    const std::uint64_t wait_ns = limiter.TryAcquire(count, SteadyNanos());
+    if (wait_ns == 0) return api::Status::Ok();
+    if (!counted) {
+      stats_.throttled.fetch_add(1, std::memory_order_relaxed);
+      counted = true;
+    }
+    if (policy != OverflowPolicy::kBlock) break;
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (now >= deadline || stopping_.load(std::memory_order_acquire)) break;
+    const std::chrono::steady_clock::time_point wake = now + std::chrono::nanoseconds(wait_ns);
+    std::this_thread::sleep_until(wake < deadline ? wake : deadline);
+  }
+  if (policy != OverflowPolicy::kCallerRuns) {
+    stats_.rejected.fetch_add(count, std::memory_order_relaxed);
+  }
+  return CK_STATUS(api::StatusCode::kWouldBlock, "submission rate limit exceeded");
 }
 
-api::Status ThreadPoolExecutor::Enqueue(std::function<void()> fn,
-                                        const TaskSubmitOptions& options) {
+bool ThreadPoolExecutor::WaitForCapacity(std::size_t count,
+                                         std::chrono::steady_clock::time_point deadline) {
+  std::unique_lock<std::mutex> lock(space_mu_);
+  // 与工作线程 "queued_tasks_ 递减 → 读 blocked_submitters_" 构成 Dekker 式握手，
+  // 条件检查与等待都在 space_mu_ 内，不会丢失唤醒。
+  blocked_submitters_.fetch_add(1);
+  bool ok = false;
+  for (;;) {
+    if (stopping_.load()) break;
+    const std::size_t capacity = queue_capacity_.load(std::memory_order_relaxed);
+    if (capacity == 0 || queued_tasks_.load() + count <= capacity) {
+      ok = true;
+      break;
+    }
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (count > capacity || now >= deadline) break;
+    // 分片等待：Reconfigure 扩容、挤出等不经过出队的容量变化也能及时发现。
+    const std::chrono::steady_clock::time_point slice = now + std::chrono::milliseconds(10);
+    space_cv_.wait_until(lock, slice < deadline ? slice : deadline);
+  }
+  blocked_submitters_.fetch_sub(1);
+  return ok;
+}
+
+void ThreadPoolExecutor::NotifySpace() {
+  std::lock_guard<std::mutex> lock(space_mu_);
+  space_cv_.notify_all();
+}
+
+std::size_t ThreadPoolExecutor::EvictQueued(TaskPriority priority, std::size_t count) {
+  // 只能挤出共享就绪队列中的任务；工作线程本地队列与串行键队列中的任务不受影响。
+  // 未分配 TaskId 的任务被丢弃时无从通知提交方（任务图节点、Future 延续、协程恢复都依赖
+  // 它们必定执行），因此只挤出带 id 的任务。
+  struct Tracked {
+    bool operator()(const TaskEntry* entry) const { return entry->id != 0; }
+  };
+  TaskEntry* victims = NULL;
+  std::size_t evicted = 0;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    while (evicted < count) {
+      TaskEntry* victim = ready_.EvictOldest(priority, Tracked());
+      for (std::size_t n = 0; victim == NULL && n < node_ready_.size(); ++n) {
+        victim = node_ready_[n]->EvictOldest(priority, Tracked());
+      }
+      if (victim == NULL) break;
+      ready_count_.fetch_sub(1, std::memory_order_relaxed);
+      victim->next = victims;
+      victims = victim;
+      ++evicted;
+    }
+  }
+  while (victims != NULL) {
+    TaskEntry* next = victims->next;
+    victims->next = NULL;
+    DiscardQueued(victims);
+    victims = next;
+  }
+  return evicted;
+}
+
+void ThreadPoolExecutor::DiscardQueued(TaskEntry* entry) {
+  // 已派发但未执行的任务被挤出：与执行完一样释放配额并接力串行键，只是不调用。
+  stats_.dropped.fetch_add(1, std::memory_order_relaxed);
+  queued_tasks_.fetch_sub(1);
+  if (entry->id != 0) MarkTaskDone(entry->id, false, false, true);
+  if (entry->serial_key != 0) AdvanceSerialLane(entry->serial_key, false);
+  RecycleEntry(entry);
+  if (pending_tasks_.fetch_sub(1) == 1) {
+    std::lock_guard<std::mutex> lock(mu_);
+    idle_cv_.notify_all();
+  }
+}
+
+void ThreadPoolExecutor::RunInline(TaskEntry* entry) {
+  stats_.submitted.fetch_add(1, std::memory_order_relaxed);
+  stats_.caller_runs.fetch_add(1, std::memory_order_relaxed);
+  RunTask(entry);
+  RecycleEntry(entry);
+}
+
+bool ThreadPoolExecutor::InjectionEnabled() const {
+  // 挤出策略需要在 ready_ 中挑选任务，注入队列中的任务无法挤出，此时仍走 ready_。
+  // 注入队列按严格优先级分道，无法保持 kFifo / kFair 的全局 FIFO 顺序，这两种策略也走 ready_。
+  if (!inject_) return false;
+  const ExecutorPolicy policy = policy_.load(std::memory_order_relaxed);
+  return policy != ExecutorPolicy::kFifo && policy != ExecutorPolicy::kFair &&
+         overflow_policy_.load(std::memory_order_relaxed) !=
+             OverflowPolicy::kDropOldestLowPriority;
+}
+
+ThreadPoolExecutor::TaskEntry* ThreadPoolExecutor::DrainInjection(WorkerContext* self) {
+  if (!inject_) return NULL;
+  std::size_t backlog = 0;
+  for (std::size_t i = 0; i < kInjectLanes; ++i) backlog += inject_[i].SizeApprox();
+  if (backlog == 0) return NULL;
+  // 一次取走积压的 1/线程数（至多 kInjectBatch 个），分摊 CAS 的同时不让单个线程囤积。
+  const std::size_t workers = std::max<std::size_t>(1, live_workers_.load());
+  const std::size_t want = std::min(kInjectBatch, backlog / workers + 1);
+  TaskEntry* batch[kInjectBatch];
+  std::size_t n = 0;
+  // 高优先级通道优先；每 16 次从低优先级通道开始，防止低优先级任务饿死。
+  const bool low_first = (++self->drains & 15u) == 0;
+  for (std::size_t k = 0; k < kInjectLanes && n < want; ++k) {
+    MpmcQueue<TaskEntry*>& lane = inject_[low_first ? k : kInjectLanes - 1 - k];
+    while (n < want && lane.TryPop(&batch[n])) ++n;
+  }
+  if (n == 0) return NULL;
+  // 本地队列按 LIFO 弹出：倒序压入，拥有者仍按注入顺序执行，其余可被窃取。
+  for (std::size_t i = n; i-- > 1;) self->local.Push(batch[i]);
+  if (n > 1) WakeIdleWorkers(n - 1);
+  return batch[0];
+}
+
+bool ThreadPoolExecutor::Dispatch(TaskEntry* entry, bool from_worker) {
+  WorkerContext* self = CurrentWorker();
+  // 指定了其他节点的任务不进本地队列，交给目标节点的队列。
+  if (self != NULL && (entry->node < 0 || entry->node == self->node)) {
+    // 工作线程内提交：直接压入本地队列，无需全局锁。
+    // 当前线程在退出前必定先清空自己的本地队列，因此无需再次检查 stopping_。
+    pending_tasks_.fetch_add(1);
+    self->local.Push(entry);
+    WakeIdleWorkers(1);
+    MaybeSpawnWorker();
+    return true;
+  }
+
+  // 外部线程提交（kWorkStealing）：进入无锁注入队列，不竞争 mu_；满时退回 ready_。
+  bool counted = false;
+  if (self == NULL && entry->node < 0 && InjectionEnabled()) {
+    if (stopping_.load(std::memory_order_acquire) && !from_worker) return false;
+    pending_tasks_.fetch_add(1);
+    counted = true;
+    if (inject_[static_cast<std::size_t>(entry->priority) % kInjectLanes].TryPush(entry)) {
+      WakeIdleWorkers(1);
+      MaybeSpawnWorker();
+      return true;
+    }
+  }
+
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    // 工作线程接力派发时自身仍会在退出前清空 ready_，关闭期间也可放行。
+    if (stopping_.load() && !from_worker && !counted) return false;
+    if (entry->node >= 0) {
+      node_ready_[entry->node]->Push(entry);
+    } else {
+      ready_.Push(entry);
+    }
+    ready_count_.fetch_add(1, std::memory_order_release);
+    if (!counted) pending_tasks_.fetch_add(1);
+    // 休眠前必须持有 mu_ 并确认就绪队列为空，因此此处读到的休眠数是准确的；
+    // 已有线程在自旋时由它直接取走任务，省掉唤醒的系统调用。
+    notify = sleeping_workers_.load() > 0 && spinning_workers_.load() == 0;
+  }
+  if (notify) cv_.notify_one();
+  MaybeSpawnWorker();
+  return true;
+}
+
+bool ThreadPoolExecutor::DispatchChain(TaskEntry* head, std::size_t count) {
+  // 整批任务目标节点相同（同一组 options），只需判断一次去向。
+  WorkerContext* self = CurrentWorker();
+  if (self != NULL && (head->node < 0 || head->node == self->node)) {
+    pending_tasks_.fetch_add(count);
+    while (head != NULL) {
+      TaskEntry* next = head->next;
+      head->next = NULL;
+      self->local.Push(head);
+      head = next;
+    }
+    WakeIdleWorkers(count);
+    MaybeSpawnWorker();
+    return true;
+  }
+
+  // 外部线程提交（kWorkStealing）：逐个压入注入队列，放不下的部分退回 ready_。
+  bool counted = false;
+  if (self == NULL && head->node < 0 && InjectionEnabled()) {
+    if (stopping_.load(std::memory_order_acquire)) return false;
+    pending_tasks_.fetch_add(count);
+    counted = true;
+    MpmcQueue<TaskEntry*>& lane = inject_[static_cast<std::size_t>(head->priority) % kInjectLanes];
+    std::size_t injected = 0;
+    while (head != NULL) {
+      // 压入后任务可能立即被执行并回收，先取出 next。
+      TaskEntry* next = head->next;
+      if (!lane.TryPush(head)) break;
+      head = next;
+      ++injected;
+    }
+    if (injected > 0) WakeIdleWorkers(injected);
+    count -= injected;
+    if (head == NULL) {
+      MaybeSpawnWorker();
+      return true;
+    }
+  }
+
+  std::size_t wake = 0;
+  std::size_t sleeping = 0;
   {
     std::lock_guard<std::mutex> lock(mu_);
-    if (stopping_) {
-      return CK_STATUS(api::StatusCode::kInternalError,
-                       "executor is stopping, cannot accept new tasks");
-    }
-    if (options_.queue_capacity > 0 && tasks_.size() >= options_.queue_capacity) {
-      ++stats_.rejected;
-      return CK_STATUS(api::StatusCode::kWouldBlock, "executor queue is full");
-    }
-    TaskEntry entry;
-    entry.fn = std::move(fn);
-    entry.priority = options.priority;
-    entry.seq = ++enqueue_seq_;
-    tasks_.push_back(std::move(entry));
-    ++pending_tasks_;
-    ++stats_.submitted;
-    stats_.queue_depth = QueueDepthLocked();
-    if (stats_.queue_depth > stats_.queue_high_watermark) {
-      stats_.queue_high_watermark = stats_.queue_depth;
-    }
-  }
-  cv_.notify_one();
+    if (stopping_.load() && !counted) return false;
+    ReadyQueue<TaskEntry>& queue = head->node >= 0 ? *node_ready_[head->node] : ready_;
+    while (head != NULL) {
+      TaskEntry* next = head->next;
+      queue.Push(head);
+      head = next;
+    }
+    ready_count_.fetch_add(count, std::memory_order_release);
+    if (!counted) pending_tasks_.fetch_add(count);
+    // 自旋中的线程会自行取走一部分任务，只为剩余部分唤醒休眠线程。
+    sleeping = sleeping_workers_.load();
+    const std::size_t spinning = spinning_workers_.load();
+    wake = count > spinning ? std::min(count - spinning, sleeping) : 0;
+  }
+  if (wake > 0 && wake >= sleeping) {
+    cv_.notify_all();
+  } else {
+    for (std::size_t i = 0; i < wake; ++i) cv_.notify_one();
+  }
+  MaybeSpawnWorker();
+  return true;
+}
+
+api::Status ThreadPoolExecutor::Enqueue(TaskEntry* entry, OverflowPolicy policy) {
+  api::Status st = Admit(1, entry->priority, policy);
+  if (!st.ok()) return st;
+  if (!Dispatch(entry, false)) {
+    queued_tasks_.fetch_sub(1);
+    return CK_STATUS(api::StatusCode::kInternalError,
+                     "executor is stopping, cannot accept new tasks");
+  }
+  stats_.submitted.fetch_add(1, std::memory_order_relaxed);
   return api::Status::Ok();
 }
 
-std::size_t ThreadPoolExecutor::PickNextTaskIndexLocked() const {
-  if (tasks_.empty()) return 0;
-  if (options_.policy == ExecutorPolicy::kFifo || options_.policy == ExecutorPolicy::kFair) {
-    return 0;
+api::Status ThreadPoolExecutor::EnqueueSerial(TaskEntry* entry, OverflowPolicy policy) {
+  api::Status st = Admit(1, entry->priority, policy);
+  if (!st.ok()) return st;
+
+  StrandShard& shard = ShardFor(entry->serial_key);
+  {
+    std::lock_guard<std::mutex> lock(shard.mu);
+    SerialLane& lane = shard.lanes[entry->serial_key];
+    if (lane.active) {
+      // 该键已有任务在途：挂到键队列尾部，由在途任务完成后接力派发，不占用工作线程。
+      entry->next = NULL;
+      if (lane.tail == NULL) {
+        lane.head = entry;
+      } else {
+        lane.tail->next = entry;
+      }
+      lane.tail = entry;
+      stats_.submitted.fetch_add(1, std::memory_order_relaxed);
+      return api::Status::Ok();
+    }
+    lane.active = true;
+  }
+
+  if (!Dispatch(entry, false)) {
+    queued_tasks_.fetch_sub(1);
+    AdvanceSerialLane(entry->serial_key, false);
+    return CK_STATUS(api::StatusCode::kInternalError,
+                     "executor is stopping, cannot accept new tasks");
   }
+  stats_.submitted.fetch_add(1, std::memory_order_relaxed);
+  return api::Status::Ok();
+}
 
-  // kPriority / kHybridFairPriority: highest priority first, FIFO within same priority.
-  std::size_t best = 0;
-  auto score = [](TaskPriority p) -> int {
-    if (p == TaskPriority::kHigh) return 2;
-    if (p == TaskPriority::kNormal) return 1;
-    return 0;
-  };
-  int best_score = score(tasks_[0].priority);
-  std::uint64_t best_seq = tasks_[0].seq;
-  for (std::size_t i = 1; i < tasks_.size(); ++i) {
-    const int s = score(tasks_[i].priority);
-    if (s > best_score || (s == best_score && tasks_[i].seq < best_seq)) {
-      best = i;
-      best_score = s;
-      best_seq = tasks_[i].seq;
+void ThreadPoolExecutor::EnqueueSerialChain(TaskEntry* head, TaskEntry* tail) {
+  const std::uint64_t key = head->serial_key;
+  StrandShard& shard = ShardFor(key);
+  TaskEntry* first = NULL;
+  {
+    std::lock_guard<std::mutex> lock(shard.mu);
+    SerialLane& lane = shard.lanes[key];
+    if (!lane.active) {
+      lane.active = true;
+      first = head;
+      head = head->next;
+      first->next = NULL;
+    }
+    if (head != NULL) {
+      if (lane.tail == NULL) {
+        lane.head = head;
+      } else {
+        lane.tail->next = head;
+      }
+      lane.tail = tail;
+    }
+  }
+  // 与关闭竞争导致派发失败时，整批已接受的任务经 AdvanceSerialLane 按取消处理。
+  if (first != NULL && !Dispatch(first, false)) {
+    DropAccepted(first);
+    AdvanceSerialLane(key, false);
+  }
+}
+
+void ThreadPoolExecutor::AdvanceSerialLane(std::uint64_t key, bool from_worker) {
+  StrandShard& shard = ShardFor(key);
+  for (;;) {
+    TaskEntry* next = NULL;
+    {
+      std::lock_guard<std::mutex> lock(shard.mu);
+      std::unordered_map<std::uint64_t, SerialLane>::iterator it = shard.lanes.find(key);
+      if (it == shard.lanes.end()) return;
+      next = it->second.head;
+      if (next == NULL) {
+        // 键队列已排空：回收该键，空闲键不占内存。
+        shard.lanes.erase(it);
+        if (shard.lanes.bucket_count() > kStrandShrinkBuckets &&
+            shard.lanes.size() * 8 < shard.lanes.bucket_count()) {
+          shard.lanes.rehash(0);
+        }
+        return;
+      }
+      it->second.head = next->next;
+      if (it->second.head == NULL) it->second.tail = NULL;
+      next->next = NULL;
     }
+    if (Dispatch(next, from_worker)) return;
+    DropAccepted(next);
   }
-  return best;
 }
 
-// ── Submit / SubmitEx / SubmitWithKey / ParallelFor ───────────────────────────
+void ThreadPoolExecutor::DropAccepted(TaskEntry* entry) {
+  // 执行器正在关闭：已接受但无法再派发的任务按取消处理。
+  queued_tasks_.fetch_sub(1);
+  if (entry->id != 0) {
+    stats_.canceled.fetch_add(1, std::memory_order_relaxed);
+    MarkTaskDone(entry->id, false, false, true);
+  }
+  RecycleEntry(entry);
+}
+
+ThreadPoolExecutor::StrandShard& ThreadPoolExecutor::ShardFor(std::uint64_t key) {
+  return strands_[(key * 0x9E3779B97F4A7C15ULL) >> (64 - kStrandShardBits)];
+}
+
+// ── Submit / SubmitEx / SubmitTask / SubmitBatch / SubmitWithKey / ParallelFor ─
 
 api::Status ThreadPoolExecutor::Submit(std::function<void()> fn) {
   if (!fn) {
     return CK_STATUS(api::StatusCode::kInvalidArgument, "fn is empty");
   }
-  return Enqueue([this, fn]() {
-    try {
-      fn();
-      std::lock_guard<std::mutex> lock(mu_);
-      ++stats_.completed;
-    } catch (...) {
-      std::lock_guard<std::mutex> lock(mu_);
-      ++stats_.failed;
-    }
-  }, TaskSubmitOptions());
+  return SubmitTask(TaskFunction(std::move(fn)), TaskSubmitOptions(), NULL);
 }
 
 api::Result<TaskId> ThreadPoolExecutor::SubmitEx(std::function<void()> fn,
@@ -130,60 +745,125 @@ api::Result<TaskId> ThreadPoolExecutor::SubmitEx(std::function<void()> fn,
   if (!fn) {
     return api::Result<TaskId>(CK_STATUS(api::StatusCode::kInvalidArgument, "fn is empty"));
   }
+  TaskId id = 0;
+  api::Status st = SubmitTask(TaskFunction(std::move(fn)), options, &id);
+  if (!st.ok()) return api::Result<TaskId>(st);
+  return api::Result<TaskId>(id);
+}
 
-  std::shared_ptr<std::mutex> key_mu;
-  if (options.serial_key != 0) {
-    std::lock_guard<std::mutex> lock(mu_);
-    key_mu = serial_key_mu_[options.serial_key];
-    if (!key_mu) {
-      key_mu.reset(new std::mutex());
-      serial_key_mu_[options.serial_key] = key_mu;
+api::Status ThreadPoolExecutor::SubmitTask(TaskFunction&& fn, const TaskSubmitOptions& options,
+                                           TaskId* out_id) {
+  if (!fn) {
+    return CK_STATUS(api::StatusCode::kInvalidArgument, "fn is empty");
+  }
+
+  TaskEntry* entry = NewEntry(std::move(fn), options);
+  if (out_id != NULL) {
+    entry->id = slots_.Allocate();
+    if (entry->id == 0) {
+      RecycleEntry(entry);
+      return CK_STATUS(api::StatusCode::kInternalError, "too many in-flight tracked tasks");
     }
   }
 
-  TaskId id = 0;
-  std::shared_ptr<TaskState> state(new TaskState());
-  {
-    std::lock_guard<std::mutex> lock(mu_);
-    id = NextTaskIdLocked();
-    states_[id] = state;
-    pending_ids_.insert(id);
+  const TaskId id = entry->id;
+  const OverflowPolicy policy = SubmitPolicy(entry->serial_key != 0);
+  api::Status st =
+      entry->serial_key != 0 ? EnqueueSerial(entry, policy) : Enqueue(entry, policy);
+  if (!st.ok()) {
+    if (policy == OverflowPolicy::kCallerRuns && st.code() == api::StatusCode::kWouldBlock) {
+      RunInline(entry);
+      if (out_id != NULL) *out_id = id;
+      return api::Status::Ok();
+    }
+    if (id != 0) slots_.Abandon(id);
+    RecycleEntry(entry);
+    return st;
   }
+  if (out_id != NULL) *out_id = id;
+  return api::Status::Ok();
+}
 
-  api::Status st = Enqueue([this, id, fn, state, key_mu]() {
-    try {
-      std::unique_lock<std::mutex> serial_lock;
-      if (key_mu) {
-        serial_lock = std::unique_lock<std::mutex>(*key_mu);
-      }
+api::Status ThreadPoolExecutor::SubmitBatch(TaskFunction* fns, std::size_t count,
+                                            const TaskSubmitOptions& options, TaskId* out_ids) {
+  if (count == 0) return api::Status::Ok();
+  if (fns == NULL) return CK_STATUS(api::StatusCode::kInvalidArgument, "fns is null");
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!fns[i]) return CK_STATUS(api::StatusCode::kInvalidArgument, "fn is empty");
+  }
 
-      bool canceled = false;
-      {
-        std::lock_guard<std::mutex> lock(mu_);
-        canceled = state->canceled;
-        state->started = true;
-      }
+  // 整批一次准入：要么全部占用队列容量，要么全部拒绝（kCallerRuns 下整批内联执行）。
+  const OverflowPolicy policy = SubmitPolicy(options.serial_key != 0);
+  api::Status st = Admit(count, options.priority, policy);
+  const bool run_inline = !st.ok() && policy == OverflowPolicy::kCallerRuns &&
+                          st.code() == api::StatusCode::kWouldBlock;
+  if (!st.ok() && !run_inline) return st;
+  if (out_ids != NULL && !slots_.AllocateBatch(out_ids, count)) {
+    if (!run_inline) queued_tasks_.fetch_sub(count);
+    return CK_STATUS(api::StatusCode::kInternalError, "too many in-flight tracked tasks");
+  }
+  if (run_inline) {
+    for (std::size_t i = 0; i < count; ++i) {
+      TaskEntry* entry = NewEntry(std::move(fns[i]), options);
+      if (out_ids != NULL) entry->id = out_ids[i];
+      RunInline(entry);
+    }
+    return api::Status::Ok();
+  }
 
-      if (canceled) {
-        MarkTaskDone(id, false, false);
-        return;
-      }
+  // 用侵入式 next 指针串成链，批量入队不需要额外的临时数组。
+  TaskEntry* head = NULL;
+  TaskEntry* tail = NULL;
+  for (std::size_t i = 0; i < count; ++i) {
+    TaskEntry* entry = NewEntry(std::move(fns[i]), options);
+    if (out_ids != NULL) entry->id = out_ids[i];
+    entry->next = NULL;
+    if (tail == NULL) {
+      head = entry;
+    } else {
+      tail->next = entry;
+    }
+    tail = entry;
+  }
 
-      fn();
-      MarkTaskDone(id, true, false);
-    } catch (...) {
-      MarkTaskDone(id, false, true);
+  if (options.serial_key != 0) {
+    EnqueueSerialChain(head, tail);
+  } else if (!DispatchChain(head, count)) {
+    queued_tasks_.fetch_sub(count);
+    while (head != NULL) {
+      TaskEntry* next = head->next;
+      if (head->id != 0) slots_.Abandon(head->id);
+      RecycleEntry(head);
+      head = next;
     }
-  }, options);
+    return CK_STATUS(api::StatusCode::kInternalError,
+                     "executor is stopping, cannot accept new tasks");
+  }
+  stats_.submitted.fetch_add(count, std::memory_order_relaxed);
+  return api::Status::Ok();
+}
 
-  if (!st.ok()) {
-    std::lock_guard<std::mutex> lock(mu_);
-    states_.erase(id);
-    pending_ids_.erase(id);
-    return api::Result<TaskId>(st);
+api::Result<TaskId> ThreadPoolExecutor::SubmitAfter(std::uint32_t delay_ms,
+                                                    std::function<void()> fn,
+                                                    const TaskSubmitOptions& options) {
+  if (!fn) {
+    return api::Result<TaskId>(CK_STATUS(api::StatusCode::kInvalidArgument, "fn is empty"));
   }
+  if (delay_ms == 0) return SubmitEx(std::move(fn), options);
+  return ScheduleTimer(delay_ms, 0, TaskFunction(std::move(fn)), options);
+}
 
-  return api::Result<TaskId>(id);
+api::Result<TaskId> ThreadPoolExecutor::SubmitEvery(std::uint32_t period_ms,
+                                                    std::function<void()> fn,
+                                                    const TaskSubmitOptions& options) {
+  if (!fn) {
+    return api::Result<TaskId>(CK_STATUS(api::StatusCode::kInvalidArgument, "fn is empty"));
+  }
+  if (period_ms == 0) {
+    return api::Result<TaskId>(
+        CK_STATUS(api::StatusCode::kInvalidArgument, "period_ms must be > 0"));
+  }
+  return ScheduleTimer(period_ms, period_ms, TaskFunction(std::move(fn)), options);
 }
 
 api::Result<TaskId> ThreadPoolExecutor::SubmitWithKey(std::uint64_t serial_key,
@@ -196,50 +876,72 @@ api::Result<TaskId> ThreadPoolExecutor::SubmitWithKey(std::uint64_t serial_key,
 api::Status ThreadPoolExecutor::ParallelFor(std::size_t begin, std::size_t end, std::size_t grain,
                                             std::function<void(std::size_t)> fn) {
   if (!fn) return CK_STATUS(api::StatusCode::kInvalidArgument, "fn is empty");
+  return ParallelForRange(begin, end, grain,
+                          [fn](std::size_t chunk_begin, std::size_t chunk_end) {
+                            for (std::size_t i = chunk_begin; i < chunk_end; ++i) fn(i);
+                          });
+}
+
+api::Status ThreadPoolExecutor::ParallelForRange(
+    std::size_t begin, std::size_t end, std::size_t grain,
+    std::function<void(std::size_t, std::size_t)> fn) {
+  if (!fn) return CK_STATUS(api::StatusCode::kInvalidArgument, "fn is empty");
   if (end < begin) return CK_STATUS(api::StatusCode::kInvalidArgument, "end must be >= begin");
   if (begin == end) return api::Status::Ok();
-  if (grain == 0) grain = 1;
 
-  std::vector<TaskId> ids;
-  for (std::size_t chunk_begin = begin; chunk_begin < end; chunk_begin += grain) {
-    const std::size_t chunk_end = std::min(chunk_begin + grain, end);
-    // Capture fn by value (shared_ptr-like copy via std::function's ref-counted capture)
-    api::Result<TaskId> sub = SubmitEx(
-        [fn, chunk_begin, chunk_end]() {
-          for (std::size_t i = chunk_begin; i < chunk_end; ++i) fn(i);
-        },
-        TaskSubmitOptions());
-    if (!sub.ok()) {
-      if (!ids.empty()) (void)WaitBatch(&ids[0], ids.size(), 0);
-      return sub.status();
-    }
-    ids.push_back(sub.value());
+  const std::size_t total = end - begin;
+  const std::size_t workers = live_workers_.load(std::memory_order_relaxed);
+  std::shared_ptr<ParallelForJob> job = std::make_shared<ParallelForJob>();
+  job->fn = std::move(fn);
+  job->end = end;
+  job->total = total;
+  job->grain = grain;
+  job->participants = workers + 1;
+  job->min_chunk = std::max<std::size_t>(1, total / (job->participants * 64));
+  job->cursor.store(begin, std::memory_order_relaxed);
+
+  // 辅助任务数不超过工作线程数与 "分块数 - 1"（调用线程自己至少处理一块）。
+  const std::size_t min_piece = grain != 0 ? grain : job->min_chunk;
+  const std::size_t max_chunks = (total + min_piece - 1) / min_piece;
+  const std::size_t helpers = std::min(workers, max_chunks - 1);
+  if (helpers > 0) {
+    // 辅助任务整批入队，一次唤醒所需的工作线程；
+    // 入队失败（队列满 / 正在关闭）时由调用线程完成全部分块。
+    std::vector<TaskFunction> fns;
+    fns.reserve(helpers);
+    for (std::size_t i = 0; i < helpers; ++i) fns.push_back(TaskFunction([job]() { job->Run(); }));
+    SubmitBatch(fns.data(), helpers, TaskSubmitOptions(), NULL);
   }
 
-  return ids.empty() ? api::Status::Ok() : WaitBatch(&ids[0], ids.size(), 0);
+  job->Run();
+  job->WaitFinished();
+  if (job->failed.load(std::memory_order_relaxed)) {
+    return CK_STATUS(api::StatusCode::kInternalError, "parallel_for body threw an exception");
+  }
+  return api::Status::Ok();
 }
 
 // ── Wait / WaitBatch / TryCancel / WaitAll ────────────────────────────────────
 
+namespace {
+
+TaskSlotTable::Deadline DeadlineAfter(std::uint32_t timeout_ms) {
+  if (timeout_ms == 0) return TaskSlotTable::Deadline::max();
+  return std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+}
+
+}  // namespace
+
 api::Status ThreadPoolExecutor::Wait(TaskId id, std::uint32_t timeout_ms) {
-  std::shared_ptr<TaskState> state;
-  {
-    std::lock_guard<std::mutex> lock(mu_);
-    typename std::unordered_map<TaskId, std::shared_ptr<TaskState> >::iterator it =
-        states_.find(id);
-    if (it == states_.end())
-      return CK_STATUS(api::StatusCode::kNotFound, "task id not found");
-    state = it->second;
+  std::uint32_t bits = 0;
+  if (!slots_.Load(id, &bits)) {
+    return CK_STATUS(api::StatusCode::kNotFound, "task id not found");
   }
-
-  std::unique_lock<std::mutex> lock(mu_);
-  if (timeout_ms == 0) {
-    state->cv.wait(lock, [state]() { return state->done; });
-    return api::Status::Ok();
+  if (TaskSlotTable::IsDone(bits)) return api::Status::Ok();
+  if (!slots_.WaitDone(id, DeadlineAfter(timeout_ms))) {
+    return CK_STATUS(api::StatusCode::kWouldBlock, "wait timeout");
   }
-  const bool done = state->cv.wait_for(
-      lock, std::chrono::milliseconds(timeout_ms), [state]() { return state->done; });
-  return done ? api::Status::Ok() : CK_STATUS(api::StatusCode::kWouldBlock, "wait timeout");
+  return api::Status::Ok();
 }
 
 api::Status ThreadPoolExecutor::WaitBatch(const TaskId* ids, std::size_t count,
@@ -247,131 +949,654 @@ api::Status ThreadPoolExecutor::WaitBatch(const TaskId* ids, std::size_t count,
   if (ids == NULL && count > 0) {
     return CK_STATUS(api::StatusCode::kInvalidArgument, "ids is null");
   }
-  const auto start = std::chrono::steady_clock::now();
   for (std::size_t i = 0; i < count; ++i) {
-    std::uint32_t remain = timeout_ms;
-    if (timeout_ms != 0) {
-      const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-          std::chrono::steady_clock::now() - start);
-      if (elapsed.count() >= timeout_ms)
-        return CK_STATUS(api::StatusCode::kWouldBlock, "wait batch timeout");
-      remain = timeout_ms - static_cast<std::uint32_t>(elapsed.count());
+    std::uint32_t bits = 0;
+    if (!slots_.Load(ids[i], &bits)) {
+      return CK_STATUS(api::StatusCode::kNotFound, "task id not found");
     }
-    api::Status st = Wait(ids[i], remain);
-    if (!st.ok()) return st;
+  }
+  if (!slots_.WaitAllDone(ids, count, DeadlineAfter(timeout_ms))) {
+    return CK_STATUS(api::StatusCode::kWouldBlock, "wait batch timeout");
   }
   return api::Status::Ok();
 }
 
 api::Status ThreadPoolExecutor::TryCancel(TaskId id) {
-  std::lock_guard<std::mutex> lock(mu_);
-  typename std::unordered_map<TaskId, std::shared_ptr<TaskState> >::iterator it =
-      states_.find(id);
-  if (it == states_.end())
+  bool newly_canceled = false;
+  const api::StatusCode code = slots_.TryCancel(id, &newly_canceled);
+  if (code == api::StatusCode::kNotFound)
     return CK_STATUS(api::StatusCode::kNotFound, "task id not found");
-  if (it->second->started || it->second->done)
+  if (code == api::StatusCode::kWouldBlock)
     return CK_STATUS(api::StatusCode::kWouldBlock, "task already running or done");
-  it->second->canceled = true;
-  ++stats_.canceled;
+  if (newly_canceled) {
+    stats_.canceled.fetch_add(1, std::memory_order_relaxed);
+    // 尚未到期的定时任务直接从时间轮摘除并置完成，无需等到到期。
+    if (timer_count_.load(std::memory_order_acquire) != 0) CancelTimer(id);
+  }
   return api::Status::Ok();
 }
 
 api::Status ThreadPoolExecutor::WaitAll() {
   std::unique_lock<std::mutex> lock(mu_);
-  idle_cv_.wait(lock, [this]() { return pending_tasks_ == 0 && active_workers_ == 0; });
+  idle_cv_.wait(lock, [this]() { return pending_tasks_.load() == 0; });
   return api::Status::Ok();
 }
 
 // ── IsTaskSucceeded / QueryStats / Reconfigure ───────────────────────────────
 
 api::Result<bool> ThreadPoolExecutor::IsTaskSucceeded(TaskId id) const {
-  std::lock_guard<std::mutex> lock(mu_);
-  typename std::unordered_map<TaskId, std::shared_ptr<TaskState> >::const_iterator it =
-      states_.find(id);
-  if (it == states_.end())
+  std::uint32_t bits = 0;
+  if (!slots_.Load(id, &bits))
     return api::Result<bool>(CK_STATUS(api::StatusCode::kNotFound,
                                        "task id not found or result expired"));
-  return api::Result<bool>(it->second->succeeded);
+  return api::Result<bool>(TaskSlotTable::IsDone(bits) &&
+                           (bits & TaskSlotTable::kSucceededFlag) != 0);
 }
 
 api::Result<ExecutorStats> ThreadPoolExecutor::QueryStats() const {
-  std::lock_guard<std::mutex> lock(mu_);
-  ExecutorStats out = stats_;
-  out.queue_depth = QueueDepthLocked();
+  ExecutorStats out;
+  out.submitted = stats_.submitted.load(std::memory_order_relaxed);
+  out.completed = stats_.completed.load(std::memory_order_relaxed);
+  out.failed = stats_.failed.load(std::memory_order_relaxed);
+  out.canceled = stats_.canceled.load(std::memory_order_relaxed);
+  out.expired = stats_.expired.load(std::memory_order_relaxed);
+  out.rejected = stats_.rejected.load(std::memory_order_relaxed);
+  out.dropped = stats_.dropped.load(std::memory_order_relaxed);
+  out.caller_runs = stats_.caller_runs.load(std::memory_order_relaxed);
+  out.throttled = stats_.throttled.load(std::memory_order_relaxed);
+  out.stolen = stats_.stolen.load(std::memory_order_relaxed);
+  out.queue_depth = QueueDepth();
+  out.queue_high_watermark = stats_.queue_high_watermark.load(std::memory_order_relaxed);
+  out.worker_count = live_workers_.load(std::memory_order_relaxed);
+  out.max_workers = spawn_limit_.load(std::memory_order_relaxed);
   return api::Result<ExecutorStats>(out);
 }
 
+namespace {
+
+LatencySummary SummarizeLatency(const std::vector<std::uint64_t>& counts, std::uint64_t count,
+                                std::uint64_t sum, std::uint64_t max, double ticks_per_ns) {
+  LatencySummary out;
+  out.count = count;
+  if (count == 0) return out;
+  const double scale = 1.0 / ticks_per_ns;
+  // 分位数取桶上界，不超过实测最大值。
+  const std::uint64_t p50 = std::min(max, LatencyHistogram::Percentile(counts, count, 0.50));
+  const std::uint64_t p99 = std::min(max, LatencyHistogram::Percentile(counts, count, 0.99));
+  const std::uint64_t p999 = std::min(max, LatencyHistogram::Percentile(counts, count, 0.999));
+  out.mean_ns = static_cast<std::uint64_t>(static_cast<double>(sum) / count * scale);
+  out.p50_ns = static_cast<std::uint64_t>(p50 * scale);
+  out.p99_ns = static_cast<std::uint64_t>(p99 * scale);
+  out.p999_ns = static_cast<std::uint64_t>(p999 * scale);
+  out.max_ns = static_cast<std::uint64_t>(max * scale);
+  return out;
+}
+
+}  // namespace
+
+api::Result<ExecutorLatencyStats> ThreadPoolExecutor::QueryLatency() const {
+  const double ticks_per_ns = clock_.TicksPerNano();
+  const std::uint64_t now = CycleClock::Now();
+  std::vector<std::uint64_t> wait_counts(LatencyHistogram::kBuckets, 0);
+  std::vector<std::uint64_t> run_counts(LatencyHistogram::kBuckets, 0);
+  std::uint64_t wait_count = 0, wait_sum = 0, wait_max = 0;
+  std::uint64_t run_count = 0, run_sum = 0, run_max = 0;
+
+  ExecutorLatencyStats out;
+  const std::size_t slot_count = worker_slot_count_.load(std::memory_order_acquire);
+  out.workers.resize(slot_count);
+  for (std::size_t i = 0; i < slot_count; ++i) {
+    const WorkerLatency* lat = workers_[i].latency.load(std::memory_order_acquire);
+    if (lat == NULL) continue;
+    lat->queue_wait.MergeInto(&wait_counts, &wait_count, &wait_sum, &wait_max);
+    lat->run.MergeInto(&run_counts, &run_count, &run_sum, &run_max);
+
+    const std::uint64_t started = lat->started.load(std::memory_order_relaxed);
+    const std::uint64_t alive = lat->alive_ticks.load(std::memory_order_relaxed) +
+                                (started != 0 && now > started ? now - started : 0);
+    const std::uint64_t busy = lat->busy_ticks.load(std::memory_order_relaxed);
+    WorkerTimeStats& w = out.workers[i];
+    w.tasks = lat->tasks.load(std::memory_order_relaxed);
+    w.busy_ns = static_cast<std::uint64_t>(busy / ticks_per_ns);
+    w.idle_ns = alive > busy ? static_cast<std::uint64_t>((alive - busy) / ticks_per_ns) : 0;
+  }
+  out.queue_wait = SummarizeLatency(wait_counts, wait_count, wait_sum, wait_max, ticks_per_ns);
+  out.run = SummarizeLatency(run_counts, run_count, run_sum, run_max, ticks_per_ns);
+  return api::Result<ExecutorLatencyStats>(out);
+}
+
 api::Status ThreadPoolExecutor::Reconfigure(const ExecutorOptions& options) {
+  if (options.max_workers > 0 && options.min_workers > options.max_workers) {
+    return CK_STATUS(api::StatusCode::kInvalidArgument, "min_workers must be <= max_workers");
+  }
   std::lock_guard<std::mutex> lock(mu_);
+  // worker_count = 0 保持当前线程数：只想调整队列或策略的调用方常常新建一份 ExecutorOptions，
+  // 不应因此把线程池悄悄改成硬件并发数。
+  ExecutorOptions scaling = options;
+  if (scaling.worker_count == 0) scaling.worker_count = options_.worker_count;
+  ApplyScalingLocked(scaling);
   options_.queue_capacity = options.queue_capacity;
   options_.policy = options.policy;
+  policy_.store(options.policy, std::memory_order_relaxed);
+  options_.aging_threshold = options.aging_threshold;
+  options_.wait_strategy = options.wait_strategy;
+  options_.spin_count = options.spin_count;
+  options_.yield_count = options.yield_count;
+  options_.enable_latency_stats = options.enable_latency_stats;
+  latency_enabled_.store(options.enable_latency_stats, std::memory_order_relaxed);
+  queue_capacity_.store(options.queue_capacity, std::memory_order_relaxed);
+  options_.overflow_policy = options.overflow_policy;
+  options_.block_timeout_ms = options.block_timeout_ms;
+  overflow_policy_.store(options.overflow_policy, std::memory_order_relaxed);
+  block_timeout_ms_.store(options.block_timeout_ms, std::memory_order_relaxed);
+  for (std::size_t i = 0; i < 3; ++i) {
+    options_.rate_limit_per_sec[i] = options.rate_limit_per_sec[i];
+    options_.rate_burst[i] = options.rate_burst[i];
+    rate_limiters_[i].Configure(options.rate_limit_per_sec[i], options.rate_burst[i]);
+  }
+  // 扩容后阻塞中的提交线程无需等到下一次出队。
+  if (blocked_submitters_.load() > 0) NotifySpace();
   return api::Status::Ok();
 }
 
+// ── Timers ────────────────────────────────────────────────────────────────────
+
+api::Result<TaskId> ThreadPoolExecutor::ScheduleTimer(std::uint32_t delay_ms,
+                                                      std::uint32_t period_ms, TaskFunction&& fn,
+                                                      const TaskSubmitOptions& options) {
+  if (stopping_.load(std::memory_order_acquire)) {
+    return api::Result<TaskId>(CK_STATUS(api::StatusCode::kInternalError,
+                                         "executor is stopping, cannot accept new tasks"));
+  }
+  std::shared_ptr<TimerTask> timer = std::make_shared<TimerTask>();
+  timer->fn = std::move(fn);
+  timer->options = options;
+  timer->period = period_ms;
+  timer->id = slots_.Allocate();
+  if (timer->id == 0) {
+    return api::Result<TaskId>(
+        CK_STATUS(api::StatusCode::kInternalError, "too many in-flight tracked tasks"));
+  }
+  const std::uint64_t expiry =
+      TimerTickAt(std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms));
+
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex> lock(timer_mu_);
+    bool started = !timer_stopping_;
+    if (started && !timer_thread_.joinable()) {
+      try {
+        timer_thread_ = std::thread(&ThreadPoolExecutor::TimerLoop, this);
+      } catch (...) {
+        started = false;
+      }
+    }
+    if (!started) {
+      slots_.Abandon(timer->id);
+      return api::Result<TaskId>(
+          CK_STATUS(api::StatusCode::kInternalError, "timer thread is not available"));
+    }
+    timers_[timer->id] = timer;
+    timer_count_.fetch_add(1, std::memory_order_release);
+    timer_wheel_.Schedule(timer.get(), expiry);
+    // 只有比定时线程当前休眠目标更早到期时才需要唤醒它重新计算。
+    notify = timer_wake_tick_ != 0 && expiry < timer_wake_tick_;
+  }
+  if (notify) timer_cv_.notify_one();
+  return api::Result<TaskId>(timer->id);
+}
+
+std::uint64_t ThreadPoolExecutor::TimerTickAt(std::chrono::steady_clock::time_point when) const {
+  // 向上取整到 1 ms：到期判断基于 "当前 tick >= 到期 tick"，因此不会提前触发。
+  if (when <= timer_epoch_) return 0;
+  const std::chrono::steady_clock::duration since = when - timer_epoch_;
+  const std::chrono::milliseconds ms = std::chrono::duration_cast<std::chrono::milliseconds>(since);
+  return static_cast<std::uint64_t>(ms.count()) + (ms < since ? 1 : 0);
+}
+
+bool ThreadPoolExecutor::CancelTimer(TaskId id) {
+  std::shared_ptr<TimerTask> timer;
+  {
+    std::lock_guard<std::mutex> lock(timer_mu_);
+    std::unordered_map<TaskId, std::shared_ptr<TimerTask> >::iterator it = timers_.find(id);
+    if (it == timers_.end()) return false;  // 已到期入队，由工作线程按取消处理
+    timer = it->second;
+    timer_wheel_.Cancel(timer.get());
+    timers_.erase(it);
+    timer_count_.fetch_sub(1, std::memory_order_release);
+  }
+  MarkTaskDone(id, false, false, true);
+  return true;
+}
+
+void ThreadPoolExecutor::FireTimer(const std::shared_ptr<TimerTask>& timer) {
+  if (timer->period == 0) {
+    TaskEntry* entry = NewEntry(std::move(timer->fn), timer->options);
+    entry->id = timer->id;
+    // timer_caller_runs：回调不能丢（如协程恢复），入队失败时在定时线程上直接执行。
+    if (entry->serial_key == 0 && timer->options.timer_caller_runs) {
+      if (!Enqueue(entry, OverflowPolicy::kCallerRuns).ok()) RunInline(entry);
+      return;
+    }
+    api::Status st = entry->serial_key != 0 ? EnqueueSerial(entry, OverflowPolicy::kReject)
+                                          : Enqueue(entry, OverflowPolicy::kReject);
+    if (!st.ok()) {
+      // 到期时无法入队（队列满 / 正在关闭）：按取消处理，拒绝已计入 rejected。
+      MarkTaskDone(entry->id, false, false, true);
+      RecycleEntry(entry);
+    }
+    return;
+  }
+
+  // 令牌已取消或截止时间已过：结束整个周期任务，而不是逐轮丢弃。
+  if (DropIfStale(timer->options.cancel_token, timer->options.deadline)) {
+    CancelTimer(timer->id);
+    return;
+  }
+  // 上一轮仍未执行完：跳过本轮，避免慢任务在队列中堆积。
+  if (timer->in_flight.exchange(true, std::memory_order_acq_rel)) return;
+  TaskEntry* entry = NewEntry(TaskFunction(PeriodicRound(this, timer)), timer->options);
+  // 失效检查已在上面按整个序列完成，单轮出队时不再重复检查。
+  entry->deadline = std::chrono::steady_clock::time_point::max();
+  entry->cancel_token = CancellationToken();
+  api::Status st = entry->serial_key != 0 ? EnqueueSerial(entry, OverflowPolicy::kReject)
+                                          : Enqueue(entry, OverflowPolicy::kReject);
+  if (!st.ok()) RecycleEntry(entry);
+}
+
+void ThreadPoolExecutor::RunPeriodic(TimerTask* timer) {
+  std::uint32_t bits = 0;
+  const bool canceled =
+      !slots_.Load(timer->id, &bits) || (bits & TaskSlotTable::kCanceledFlag) != 0;
+  // in_flight 由 PeriodicRound 析构时复位（任务抛出异常时同样如此）。
+  if (!canceled) timer->fn();
+}
+
+void ThreadPoolExecutor::StopTimers() {
+  {
+    std::lock_guard<std::mutex> lock(timer_mu_);
+    timer_stopping_ = true;
+  }
+  timer_cv_.notify_all();
+  if (timer_thread_.joinable()) timer_thread_.join();
+
+  // 定时线程已退出，无需再加锁：未到期的定时任务按取消处理。
+  for (std::unordered_map<TaskId, std::shared_ptr<TimerTask> >::iterator it = timers_.begin();
+       it != timers_.end(); ++it) {
+    timer_wheel_.Cancel(it->second.get());
+    bool newly_canceled = false;
+    slots_.TryCancel(it->first, &newly_canceled);
+    if (newly_canceled) stats_.canceled.fetch_add(1, std::memory_order_relaxed);
+    MarkTaskDone(it->first, false, false, true);
+  }
+  timers_.clear();
+  timer_count_.store(0);
+}
+
+void ThreadPoolExecutor::TimerLoop() {
+  std::vector<TimerWheel::Node*> expired;
+  std::vector<std::shared_ptr<TimerTask> > due;
+  std::unique_lock<std::mutex> lock(timer_mu_);
+  while (!timer_stopping_) {
+    expired.clear();
+    timer_wheel_.Advance(TimerTickAt(std::chrono::steady_clock::now()), &expired);
+    if (expired.empty()) {
+      const std::uint64_t wake = timer_wheel_.NextWakeTick();
+      timer_wake_tick_ = wake;
+      if (wake == std::numeric_limits<std::uint64_t>::max()) {
+        timer_cv_.wait(lock);
+      } else {
+        timer_cv_.wait_until(lock, timer_epoch_ + std::chrono::milliseconds(wake));
+      }
+      timer_wake_tick_ = 0;
+      continue;
+    }
+
+    for (std::size_t i = 0; i < expired.size(); ++i) {
+      TimerTask* timer = static_cast<TimerTask*>(expired[i]);
+      std::unordered_map<TaskId, std::shared_ptr<TimerTask> >::iterator it =
+          timers_.find(timer->id);
+      due.push_back(it->second);
+      if (timer->period == 0) {
+        timers_.erase(it);
+        timer_count_.fetch_sub(1, std::memory_order_release);
+        continue;
+      }
+      // 固定频率：下一次到期 = 本次到期 + 周期；落后时跳过已错过的轮次。
+      const std::uint64_t now = timer_wheel_.Now();
+      std::uint64_t next = timer->expiry + timer->period;
+      if (next <= now) next += ((now - next) / timer->period + 1) * timer->period;
+      timer_wheel_.Schedule(timer, next);
+    }
+    // 入队在锁外进行：入队可能阻塞在执行器锁上，不应拖住 SubmitAfter / TryCancel。
+    lock.unlock();
+    for (std::size_t i = 0; i < due.size(); ++i) FireTimer(due[i]);
+    due.clear();
+    lock.lock();
+  }
+}
+
 // ── Internal helpers ──────────────────────────────────────────────────────────
 
-TaskId ThreadPoolExecutor::NextTaskIdLocked() { return next_task_id_++; }
+void ThreadPoolExecutor::MarkTaskDone(TaskId id, bool executed, bool failed, bool canceled) {
+  // 先计数再置完成：Wait 返回后 QueryStats 必然已包含该任务。
+  if (!canceled) {
+    if (failed) {
+      stats_.failed.fetch_add(1, std::memory_order_relaxed);
+    } else if (executed) {
+      stats_.completed.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  slots_.Finish(id, executed && !failed);
+}
 
-void ThreadPoolExecutor::MarkTaskDone(TaskId id, bool executed, bool failed) {
-  std::lock_guard<std::mutex> lock(mu_);
-  typename std::unordered_map<TaskId, std::shared_ptr<TaskState> >::iterator it =
-      states_.find(id);
-  if (it == states_.end()) return;
+std::size_t ThreadPoolExecutor::QueueDepth() const { return queued_tasks_.load(); }
+
+void ThreadPoolExecutor::NoteQueueDepth(std::size_t depth) {
+  std::size_t high = stats_.queue_high_watermark.load(std::memory_order_relaxed);
+  while (depth > high &&
+         !stats_.queue_high_watermark.compare_exchange_weak(high, depth,
+                                                            std::memory_order_relaxed)) {
+  }
+}
+
+const ThreadPoolExecutor*& ThreadPoolExecutor::CurrentPoolSlot() {
+  static thread_local const ThreadPoolExecutor* current = NULL;
+  return current;
+}
 
-  it->second->done = true;
-  it->second->succeeded = executed && !failed;
-  it->second->cv.notify_all();
-  pending_ids_.erase(id);
+ThreadPoolExecutor::WorkerContext*& ThreadPoolExecutor::CurrentWorkerSlot() {
+  static thread_local WorkerContext* current = NULL;
+  return current;
+}
+
+ThreadPoolExecutor::WorkerContext* ThreadPoolExecutor::CurrentWorker() const {
+  WorkerContext* ctx = CurrentWorkerSlot();
+  return (ctx != NULL && ctx->owner == this) ? ctx : NULL;
+}
+
+void ThreadPoolExecutor::WakeIdleWorkers(std::size_t count) {
+  // 与 AcquireTask 中 "sleeping_workers_ 自增 → 检查本地队列" 构成 Dekker 式握手：
+  // 双方至少有一方能观察到对方，从而不会丢失唤醒。
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const std::size_t sleeping = sleeping_workers_.load();
+  if (sleeping == 0) return;
+  // 自旋线程同样会检查各本地队列，只需为它们覆盖不到的部分唤醒休眠线程。
+  const std::size_t spinning = spinning_workers_.load();
+  if (count <= spinning) return;
+  const std::size_t wake = count - spinning;
+  { std::lock_guard<std::mutex> lock(mu_); }
+  if (wake >= sleeping) {
+    cv_.notify_all();
+  } else {
+    for (std::size_t i = 0; i < wake; ++i) cv_.notify_one();
+  }
+}
+
+bool ThreadPoolExecutor::AnyLocalWork() const {
+  for (std::size_t i = 0; inject_ && i < kInjectLanes; ++i) {
+    if (!inject_[i].EmptyApprox()) return true;
+  }
+  const std::size_t n = worker_slot_count_.load(std::memory_order_acquire);
+  for (std::size_t i = 0; i < n; ++i) {
+    const WorkerContext* ctx = workers_[i].ctx.load(std::memory_order_acquire);
+    if (ctx != NULL && !ctx->local.EmptyApprox()) return true;
+  }
+  return false;
+}
 
-  done_ids_.push_back(id);
-  while (done_ids_.size() > max_retained_states_) {
-    const TaskId old_id = done_ids_.front();
-    done_ids_.pop_front();
-    typename std::unordered_map<TaskId, std::shared_ptr<TaskState> >::iterator old =
-        states_.find(old_id);
-    if (old != states_.end() && old->second->done) {
-      states_.erase(old);
+ThreadPoolExecutor::TaskEntry* ThreadPoolExecutor::TrySteal(WorkerContext* self) {
+  const std::size_t n = worker_slot_count_.load(std::memory_order_acquire);
+  if (n < 2) return NULL;
+  // xorshift64：随机选择起始受害者，避免所有窃取者同时扑向同一个队列。
+  self->rng ^= self->rng << 13;
+  self->rng ^= self->rng >> 7;
+  self->rng ^= self->rng << 17;
+  const std::size_t start = static_cast<std::size_t>(self->rng % n);
+  for (std::size_t i = 0; i < n; ++i) {
+    WorkerContext* victim = workers_[(start + i) % n].ctx.load(std::memory_order_acquire);
+    if (victim == NULL || victim == self) continue;
+    TaskEntry* entry = NULL;
+    if (victim->local.Steal(&entry)) {
+      stats_.stolen.fetch_add(1, std::memory_order_relaxed);
+      return entry;
     }
   }
+  return NULL;
+}
 
-  if (it->second->canceled) return;
-  if (failed) {
-    ++stats_.failed;
-  } else if (executed) {
-    ++stats_.completed;
+bool ThreadPoolExecutor::SpinForWork(WaitStrategy strategy, std::uint32_t spin_count,
+                                     std::uint32_t yield_count) {
+  // 不持有 mu_ 轮询就绪计数与各本地队列。返回 true 表示应重新取任务：
+  // 观察到了新任务，或 kBusyPoll 一轮结束（借此在锁内复查退役条件）。
+  static const std::uint32_t kBusyPollRound = 1u << 14;
+  spinning_workers_.fetch_add(1);
+  bool found = false;
+  for (std::uint32_t i = 0;; ++i) {
+    if (stopping_.load(std::memory_order_relaxed)) break;
+    if (ready_count_.load(std::memory_order_acquire) != 0 || AnyLocalWork()) {
+      found = true;
+      break;
+    }
+    if (strategy == WaitStrategy::kBusyPoll) {
+      if (i == kBusyPollRound) {
+        found = true;
+        break;
+      }
+      CpuRelax();
+    } else if (i < spin_count) {
+      CpuRelax();
+    } else if (i < spin_count + yield_count) {
+      std::this_thread::yield();
+    } else {
+      break;
+    }
   }
+  spinning_workers_.fetch_sub(1);
+  return found;
 }
 
-std::size_t ThreadPoolExecutor::QueueDepthLocked() const { return tasks_.size(); }
+ThreadPoolExecutor::TaskEntry* ThreadPoolExecutor::AcquireTask(WorkerContext* self,
+                                                               std::size_t index) {
+  TaskEntry* entry = NULL;
+  if (self != NULL && self->local.Pop(&entry)) return entry;
+  if (self != NULL && (entry = DrainInjection(self)) != NULL) return entry;
 
-void ThreadPoolExecutor::WorkerLoop() {
+  const std::int32_t node = workers_[index].node;
+  std::unique_lock<std::mutex> lock(mu_);
   for (;;) {
-    std::function<void()> task;
-    {
-      std::unique_lock<std::mutex> lock(mu_);
-      cv_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
-      if (stopping_ && tasks_.empty()) return;
-      const std::size_t idx = PickNextTaskIndexLocked();
-      task = std::move(tasks_[idx].fn);
-      tasks_.erase(tasks_.begin() + static_cast<std::ptrdiff_t>(idx));
-      ++active_workers_;
+    entry = PopReadyLocked(node);
+    if (entry != NULL) {
+      // 生产者看到有线程自旋时不发唤醒；取走任务后若仍有积压且无人自旋，接力唤醒一个。
+      if (options_.wait_strategy != WaitStrategy::kBlocking &&
+          ready_count_.load(std::memory_order_relaxed) != 0 && sleeping_workers_.load() > 0 &&
+          spinning_workers_.load() == 0) {
+        cv_.notify_one();
+      }
+      return entry;
+    }
+    if (self != NULL) {
+      lock.unlock();
+      entry = DrainInjection(self);
+      if (entry == NULL) entry = TrySteal(self);
+      if (entry != NULL) return entry;
+      lock.lock();
+      if (!ReadyEmptyLocked()) continue;
+    }
+
+    // 线程数超过上限（Reconfigure 缩容）：本地队列已空，直接退役。
+    const bool elastic = options_.max_workers > 0;
+    const std::size_t retire_above = elastic ? options_.max_workers : options_.worker_count;
+    if (!stopping_.load() && live_workers_.load() > retire_above) {
+      RetireWorkerLocked(index);
+      return NULL;
+    }
+
+    if (options_.wait_strategy != WaitStrategy::kBlocking && !stopping_.load()) {
+      const WaitStrategy strategy = options_.wait_strategy;
+      const std::uint32_t spin_count = options_.spin_count;
+      const std::uint32_t yield_count = options_.yield_count;
+      lock.unlock();
+      const bool found = SpinForWork(strategy, spin_count, yield_count);
+      lock.lock();
+      if (found) continue;
     }
 
+    sleeping_workers_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!AnyLocalWork()) {
+      if (stopping_.load()) {
+        sleeping_workers_.fetch_sub(1);
+        return NULL;
+      }
+      if (elastic && options_.idle_timeout_ms > 0 &&
+          live_workers_.load() > options_.min_workers) {
+        const std::cv_status waited =
+            cv_.wait_for(lock, std::chrono::milliseconds(options_.idle_timeout_ms));
+        // 空闲超时：重新确认确实无事可做后退役，唤醒与超时同时发生时不会丢任务。
+        if (waited == std::cv_status::timeout && ReadyEmptyLocked() && !stopping_.load() &&
+            live_workers_.load() > options_.min_workers && !AnyLocalWork()) {
+          sleeping_workers_.fetch_sub(1);
+          RetireWorkerLocked(index);
+          return NULL;
+        }
+      } else {
+        cv_.wait(lock);
+      }
+    }
+    sleeping_workers_.fetch_sub(1);
+  }
+}
+
+ThreadPoolExecutor::TaskEntry* ThreadPoolExecutor::NewEntry(TaskFunction&& fn,
+                                                            const TaskSubmitOptions& options) {
+  TaskEntry* entry = entry_pool_.Acquire();
+  entry->fn = std::move(fn);
+  entry->priority = options.priority;
+  entry->id = 0;
+  entry->serial_key = options.serial_key;
+  entry->enqueue_tick = latency_enabled_.load(std::memory_order_relaxed) ? CycleClock::Now() : 0;
+  entry->deadline = options.deadline;
+  entry->cancel_token = options.cancel_token;
+  entry->node = options.numa_node >= 0 &&
+                        static_cast<std::size_t>(options.numa_node) < node_ready_.size()
+                    ? options.numa_node
+                    : -1;
+  return entry;
+}
+
+void ThreadPoolExecutor::RecycleEntry(TaskEntry* entry) {
+  entry->fn.Reset();
+  entry->serial_key = 0;
+  entry->id = 0;
+  entry->cancel_token = CancellationToken();
+  entry_pool_.Release(entry);
+}
+
+bool ThreadPoolExecutor::DropIfStale(const CancellationToken& token,
+                                     std::chrono::steady_clock::time_point deadline) {
+  if (token.IsCancellationRequested()) {
+    stats_.canceled.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  if (deadline != std::chrono::steady_clock::time_point::max() &&
+      std::chrono::steady_clock::now() >= deadline) {
+    stats_.expired.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+void ThreadPoolExecutor::RunTask(TaskEntry* entry) {
+  if (entry->id == 0) {
+    if (DropIfStale(entry->cancel_token, entry->deadline)) return;
     try {
-      task();
+      entry->fn();
+      stats_.completed.fetch_add(1, std::memory_order_relaxed);
     } catch (...) {
-      std::lock_guard<std::mutex> lock(mu_);
-      ++stats_.failed;
+      stats_.failed.fetch_add(1, std::memory_order_relaxed);
     }
+    return;
+  }
 
-    {
+  if (!slots_.TryStart(entry->id)) {
+    MarkTaskDone(entry->id, false, false, true);
+    return;
+  }
+  // 已进入运行态但尚未调用：令牌已取消或截止时间已过则不再执行，Wait 照常返回。
+  if (DropIfStale(entry->cancel_token, entry->deadline)) {
+    MarkTaskDone(entry->id, false, false, true);
+    return;
+  }
+  bool failed = false;
+  try {
+    entry->fn();
+  } catch (...) {
+    failed = true;
+  }
+  MarkTaskDone(entry->id, !failed, failed, false);
+}
+
+void ThreadPoolExecutor::WorkerLoop(std::size_t index) {
+  WorkerContext* self = workers_[index].ctx.load(std::memory_order_acquire);
+  CurrentWorkerSlot() = self;
+  CurrentPoolSlot() = this;
+  if (!workers_[index].cpus.empty()) PinCurrentThread(workers_[index].cpus);
+  WorkerLatency* lat = workers_[index].latency.load(std::memory_order_acquire);
+  if (lat != NULL) lat->started.store(CycleClock::Now(), std::memory_order_relaxed);
+  for (;;) {
+    TaskEntry* entry = AcquireTask(self, index);
+    if (entry == NULL) break;
+    queued_tasks_.fetch_sub(1);
+    if (blocked_submitters_.load() > 0) NotifySpace();
+    // 扩容不只依赖提交路径：取走任务后积压仍超过阈值时由工作线程补充线程，否则突发提交
+    // 恰逢有线程计为休眠（含已被唤醒尚未醒来者）时，若此后再无提交，线程数会一直停在原值。
+    MaybeSpawnWorker();
+
+    if (latency_enabled_.load(std::memory_order_relaxed)) {
+      const std::uint64_t enqueue_tick = entry->enqueue_tick;
+      const std::uint64_t start = CycleClock::Now();
+      RunTask(entry);
+      RecordTiming(index, enqueue_tick, start, CycleClock::Now());
+    } else {
+      RunTask(entry);
+    }
+    // 先接力派发同键的下一个任务，再递减 pending_tasks_，保证 WaitAll 不会提前返回。
+    if (entry->serial_key != 0) AdvanceSerialLane(entry->serial_key, true);
+    RecycleEntry(entry);
+
+    if (pending_tasks_.fetch_sub(1) == 1) {
       std::lock_guard<std::mutex> lock(mu_);
-      --active_workers_;
-      if (pending_tasks_ > 0) --pending_tasks_;
-      stats_.queue_depth = QueueDepthLocked();
       idle_cv_.notify_all();
     }
   }
+  lat = workers_[index].latency.load(std::memory_order_acquire);
+  if (lat != NULL) {
+    const std::uint64_t started = lat->started.load(std::memory_order_relaxed);
+    lat->alive_ticks.store(lat->alive_ticks.load(std::memory_order_relaxed) +
+                               (CycleClock::Now() - started),
+                           std::memory_order_relaxed);
+    lat->started.store(0, std::memory_order_relaxed);
+  }
+  CurrentWorkerSlot() = NULL;
+  CurrentPoolSlot() = NULL;
+}
+
+void ThreadPoolExecutor::RecordTiming(std::size_t index, std::uint64_t enqueue_tick,
+                                      std::uint64_t start, std::uint64_t end) {
+  WorkerLatency* lat = workers_[index].latency.load(std::memory_order_relaxed);
+  if (lat == NULL) {
+    // 首次计时（或运行中才开启统计）：存活时间从此刻算起。
+    lat = new WorkerLatency();
+    lat->started.store(start, std::memory_order_relaxed);
+    workers_[index].latency.store(lat, std::memory_order_release);
+  }
+  // 跨核 TSC 的微小偏差可能使差值为负，此类样本不计入排队时间。
+  if (enqueue_tick != 0 && start >= enqueue_tick) lat->queue_wait.Record(start - enqueue_tick);
+  lat->run.Record(end - start);
+  lat->tasks.store(lat->tasks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  lat->busy_ticks.store(lat->busy_ticks.load(std::memory_order_relaxed) + (end - start),
+                        std::memory_order_relaxed);
 }
 
 #undef CK_STATUS
@@ -1,19 +1,28 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
-#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
-#include <set>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "corekit/task/iexecutor.hpp"
+#include "task/cpu_topology.hpp"
+#include "task/latency_histogram.hpp"
+#include "task/mpmc_queue.hpp"
+#include "task/rate_limiter.hpp"
+#include "task/ready_queue.hpp"
+#include "task/task_pool.hpp"
+#include "task/task_slot_table.hpp"
+#include "task/timer_wheel.hpp"
+#include "task/work_stealing_deque.hpp"
 
 namespace corekit {
 namespace task {
@@ -32,10 +41,20 @@ class ThreadPoolExecutor : public IExecutor {
   api::Status Submit(std::function<void()> fn) override;
   api::Result<TaskId> SubmitEx(std::function<void()> fn,
                                const TaskSubmitOptions& options) override;
+  api::Status SubmitTask(TaskFunction&& fn, const TaskSubmitOptions& options,
+                         TaskId* out_id) override;
+  api::Status SubmitBatch(TaskFunction* fns, std::size_t count,
+                          const TaskSubmitOptions& options, TaskId* out_ids) override;
+  api::Result<TaskId> SubmitAfter(std::uint32_t delay_ms, std::function<void()> fn,
+                                  const TaskSubmitOptions& options) override;
+  api::Result<TaskId> SubmitEvery(std::uint32_t period_ms, std::function<void()> fn,
+                                  const TaskSubmitOptions& options) override;
   api::Result<TaskId> SubmitWithKey(std::uint64_t serial_key,
                                     std::function<void()> fn) override;
   api::Status ParallelFor(std::size_t begin, std::size_t end, std::size_t grain,
                           std::function<void(std::size_t)> fn) override;
+  api::Status ParallelForRange(std::size_t begin, std::size_t end, std::size_t grain,
+                               std::function<void(std::size_t, std::size_t)> fn) override;
 
   api::Status Wait(TaskId id, std::uint32_t timeout_ms) override;
   api::Status WaitBatch(const TaskId* ids, std::size_t count,
@@ -45,48 +64,228 @@ class ThreadPoolExecutor : public IExecutor {
 
   api::Result<bool> IsTaskSucceeded(TaskId id) const override;
   api::Result<ExecutorStats> QueryStats() const override;
+  api::Result<ExecutorLatencyStats> QueryLatency() const override;
   api::Status Reconfigure(const ExecutorOptions& options) override;
 
  private:
-  struct TaskState {
-    bool started = false;
-    bool done = false;
-    bool canceled = false;
-    bool succeeded = false;  // 任务无异常完成时为 true
-    std::condition_variable cv;
-  };
-
+  // 池化的任务槽：可调用对象内联存放，稳态下入队/执行不触发堆分配。
   struct TaskEntry {
-    std::function<void()> fn;
+    TaskFunction fn;
     TaskPriority priority = TaskPriority::kNormal;
-    std::uint64_t seq = 0;
+    TaskId id = 0;                     // 0 = 即发任务（不跟踪状态）
+    std::uint64_t serial_key = 0;      // 0 = 无串行约束
+    std::int32_t node = -1;            // 目标节点队列，-1 = 全局队列
+    std::uint64_t seq = 0;             // ReadyQueue 维护
+    std::uint64_t dispatch_mark = 0;   // ReadyQueue 维护
+    std::uint64_t enqueue_tick = 0;    // 提交时的 CycleClock 读数，0 = 未计时
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::time_point::max();  // 出队时已过期则丢弃
+    CancellationToken cancel_token;    // 出队时已取消则丢弃
+    TaskEntry* next = NULL;            // ReadyQueue / 串行键队列侵入式链表
+    std::uint32_t pool_index = 0;      // TaskPool 维护
+    std::atomic<std::uint32_t> pool_next{0};
+  };
+
+  // kWorkStealing 后端下每个工作线程的本地上下文。
+  struct WorkerContext {
+    ThreadPoolExecutor* owner = NULL;
+    std::int32_t node = -1;
+    std::uint64_t rng = 0;
+    std::uint32_t drains = 0;  // 从注入队列批量取任务的次数
+    WorkStealingDeque<TaskEntry*> local;
+  };
+
+  // 工作线程的耗时统计，只由该线程写入（tasks / busy_ticks / alive_ticks / started 同理）。
+  struct WorkerLatency {
+    LatencyHistogram queue_wait;
+    LatencyHistogram run;
+    std::atomic<std::uint64_t> tasks{0};
+    std::atomic<std::uint64_t> busy_ticks{0};
+    std::atomic<std::uint64_t> alive_ticks{0};  // 已退出的线程累计存活时间
+    std::atomic<std::uint64_t> started{0};      // 当前线程的启动时刻，0 = 槽位空闲
+  };
+
+  // 工作线程槽位。槽位数组在构造时一次分配，WorkerContext 首次使用时创建并在
+  // 槽位复用时保留，因此窃取方可以无锁遍历 [0, worker_slot_count_) 的上下文。
+  struct WorkerSlot {
+    std::thread thread;
+    std::atomic<WorkerContext*> ctx{NULL};  // 仅 kWorkStealing 后端
+    bool running = false;                   // 受 mu_ 保护
+    std::int32_t node = -1;                 // 所属节点，-1 = 无节点队列
+    std::vector<std::uint32_t> cpus;        // 绑定的 CPU，空 = 不绑定
+    std::atomic<WorkerLatency*> latency{NULL};  // 首次计时时创建，槽位复用时保留
+  };
+
+  // 执行器运行时计数器（原子，工作线程热路径不持有 mu_）。
+  struct StatsCounters {
+    std::atomic<std::uint64_t> submitted{0};
+    std::atomic<std::uint64_t> completed{0};
+    std::atomic<std::uint64_t> failed{0};
+    std::atomic<std::uint64_t> canceled{0};
+    std::atomic<std::uint64_t> expired{0};
+    std::atomic<std::uint64_t> rejected{0};
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<std::uint64_t> caller_runs{0};
+    std::atomic<std::uint64_t> throttled{0};
+    std::atomic<std::uint64_t> stolen{0};
+    std::atomic<std::size_t> queue_high_watermark{0};
+  };
+
+  // 串行键队列（strand）：同一键同时至多一个任务在就绪队列或执行中，
+  // 其余按提交顺序挂在 head..tail，由在途任务完成后接力派发；排空即从表中删除。
+  struct SerialLane {
+    TaskEntry* head = NULL;
+    TaskEntry* tail = NULL;
+    bool active = false;
+  };
+
+  // 按键散列分片，降低不同键之间的锁竞争。
+  struct StrandShard {
+    std::mutex mu;
+    std::unordered_map<std::uint64_t, SerialLane> lanes;
+    char pad[64];
   };
 
+  // 延时 / 周期任务：节点挂在 timer_wheel_ 上，由 timer_thread_ 推进并在到期时入队。
+  // timers_ 持有全部未到期的定时任务，同时作为 TryCancel 的索引；周期任务的每一轮以即发任务
+  // 入队，通过 shared_ptr 保活。
+  struct TimerTask : TimerWheel::Node {
+    TaskFunction fn;
+    TaskSubmitOptions options;
+    TaskId id = 0;
+    std::uint64_t period = 0;             // tick 数，0 = 一次性
+    std::atomic<bool> in_flight{false};   // 周期任务的上一轮是否尚未执行完
+  };
+
+  // 周期任务单轮的可调用对象。无论该轮是执行完、被挤出还是因关闭被丢弃，
+  // 销毁时都复位 in_flight，保证后续轮次不会被永久跳过。
+  struct PeriodicRound {
+    PeriodicRound(ThreadPoolExecutor* o, const std::shared_ptr<TimerTask>& t) : owner(o), timer(t) {}
+    PeriodicRound(PeriodicRound&& other) noexcept
+        : owner(other.owner), timer(std::move(other.timer)) {}
+    ~PeriodicRound() {
+      if (timer) timer->in_flight.store(false, std::memory_order_release);
+    }
+    void operator()() { owner->RunPeriodic(timer.get()); }
+
+    ThreadPoolExecutor* owner;
+    std::shared_ptr<TimerTask> timer;
+  };
+
+  static const std::size_t kStrandShardBits = 4;
+  static const std::size_t kStrandShards = 1u << kStrandShardBits;
+  static const std::size_t kStrandShrinkBuckets = 1024;
+
+  static WorkerContext*& CurrentWorkerSlot();
+  static const ThreadPoolExecutor*& CurrentPoolSlot();
+
   std::size_t NormalizeWorkerCount(std::size_t worker_count) const;
-  api::Status Enqueue(std::function<void()> fn, const TaskSubmitOptions& options);
-  std::size_t PickNextTaskIndexLocked() const;
-  TaskId NextTaskIdLocked();
-  void MarkTaskDone(TaskId id, bool executed, bool failed);
-  std::size_t QueueDepthLocked() const;
-  void WorkerLoop();
-
-  std::vector<std::thread> workers_;
-  std::deque<TaskEntry> tasks_;
+  void ApplyScalingLocked(const ExecutorOptions& options);
+  bool SpawnWorkerLocked();
+  void MaybeSpawnWorker();
+  void RetireWorkerLocked(std::size_t index);
+  void PlaceWorker(std::size_t index, std::int32_t* node, std::vector<std::uint32_t>* cpus) const;
+  TaskEntry* PopReadyLocked(std::int32_t node);
+  bool ReadyEmptyLocked() const;
+  OverflowPolicy SubmitPolicy(bool serial) const;
+  api::Status Admit(std::size_t count, TaskPriority priority, OverflowPolicy policy);
+  api::Status Throttle(std::size_t count, TaskPriority priority, OverflowPolicy policy,
+                       std::chrono::steady_clock::time_point deadline);
+  bool WaitForCapacity(std::size_t count, std::chrono::steady_clock::time_point deadline);
+  void NotifySpace();
+  std::size_t EvictQueued(TaskPriority priority, std::size_t count);
+  void DiscardQueued(TaskEntry* entry);
+  void RunInline(TaskEntry* entry);
+  bool InjectionEnabled() const;
+  TaskEntry* DrainInjection(WorkerContext* self);
+  bool Dispatch(TaskEntry* entry, bool from_worker);
+  bool DispatchChain(TaskEntry* head, std::size_t count);
+  api::Status Enqueue(TaskEntry* entry, OverflowPolicy policy);
+  api::Status EnqueueSerial(TaskEntry* entry, OverflowPolicy policy);
+  void EnqueueSerialChain(TaskEntry* head, TaskEntry* tail);
+  void AdvanceSerialLane(std::uint64_t key, bool from_worker);
+  void DropAccepted(TaskEntry* entry);
+  StrandShard& ShardFor(std::uint64_t key);
+  TaskEntry* NewEntry(TaskFunction&& fn, const TaskSubmitOptions& options);
+  void RecycleEntry(TaskEntry* entry);
+  bool DropIfStale(const CancellationToken& token,
+                   std::chrono::steady_clock::time_point deadline);
+  void RunTask(TaskEntry* entry);
+  void MarkTaskDone(TaskId id, bool executed, bool failed, bool canceled);
+  api::Result<TaskId> ScheduleTimer(std::uint32_t delay_ms, std::uint32_t period_ms,
+                                    TaskFunction&& fn, const TaskSubmitOptions& options);
+  std::uint64_t TimerTickAt(std::chrono::steady_clock::time_point when) const;
+  bool CancelTimer(TaskId id);
+  void FireTimer(const std::shared_ptr<TimerTask>& timer);
+  void RunPeriodic(TimerTask* timer);
+  void StopTimers();
+  void TimerLoop();
+  std::size_t QueueDepth() const;
+  void NoteQueueDepth(std::size_t depth);
+  WorkerContext* CurrentWorker() const;
+  void WakeIdleWorkers(std::size_t count);
+  bool AnyLocalWork() const;
+  TaskEntry* TrySteal(WorkerContext* self);
+  bool SpinForWork(WaitStrategy strategy, std::uint32_t spin_count, std::uint32_t yield_count);
+  TaskEntry* AcquireTask(WorkerContext* self, std::size_t index);
+  void RecordTiming(std::size_t index, std::uint64_t enqueue_tick, std::uint64_t start,
+                    std::uint64_t end);
+  void WorkerLoop(std::size_t index);
+
+  static const std::size_t kMaxWorkers = 1024;
+  std::unique_ptr<WorkerSlot[]> workers_;
+  std::atomic<std::size_t> worker_slot_count_;  // 曾使用过的槽位上界
+  std::atomic<std::size_t> live_workers_;
+  std::atomic<std::size_t> spawn_limit_;        // 弹性模式下的 max_workers；0 = 不按需新增
+  std::atomic<std::size_t> spawn_queue_depth_;
+  ReadyQueue<TaskEntry> ready_;
+  // kWorkStealing 后端下非工作线程提交的无锁注入队列，按优先级分道（下标为 TaskPriority）。
+  // 由工作线程批量取入本地队列；注入队列满时退回 ready_。
+  static const std::size_t kInjectLanes = 3;
+  static const std::size_t kInjectCapacity = 1024;
+  static const std::size_t kInjectBatch = 32;
+  std::unique_ptr<MpmcQueue<TaskEntry*>[]> inject_;
+  // options_.policy 的无锁副本（options_ 受 mu_ 保护），供提交路径判断能否走注入队列。
+  std::atomic<ExecutorPolicy> policy_;
+  // 每个 NUMA 节点的本地就绪队列（affinity != kNone 时），受 mu_ 保护。
+  std::vector<std::unique_ptr<ReadyQueue<TaskEntry> > > node_ready_;
+  CpuTopology topology_;
   mutable std::mutex mu_;
   std::condition_variable cv_;
   std::condition_variable idle_cv_;
-  bool stopping_;
-  std::size_t active_workers_;
-  std::size_t pending_tasks_;
-  TaskId next_task_id_;
-  std::uint64_t enqueue_seq_;
-  std::size_t max_retained_states_;
-  ExecutorStats stats_;
+  std::atomic<bool> stopping_;
+  std::atomic<std::size_t> sleeping_workers_;
+  std::atomic<std::size_t> spinning_workers_;  // 正在自旋等待任务的线程数（不含休眠）
+  std::atomic<std::size_t> ready_count_;       // ready_ 与节点队列中的任务数（在 mu_ 内修改）
+  std::atomic<std::size_t> pending_tasks_;  // 已入队但尚未执行完毕的任务数
+  std::atomic<std::size_t> queued_tasks_;   // 已入队但尚未开始执行的任务数
+  std::atomic<std::size_t> queue_capacity_;
+  // 过载策略与限速；kBlock 的提交线程在 space_cv_ 上等待，工作线程出队时按需唤醒。
+  std::atomic<OverflowPolicy> overflow_policy_;
+  std::atomic<std::uint32_t> block_timeout_ms_;
+  RateLimiter rate_limiters_[3];
+  std::mutex space_mu_;
+  std::condition_variable space_cv_;
+  std::atomic<std::size_t> blocked_submitters_;
+  StatsCounters stats_;
+  std::atomic<bool> latency_enabled_;
+  CycleClock clock_;
   ExecutorOptions options_;
-  std::unordered_map<TaskId, std::shared_ptr<TaskState> > states_;
-  std::set<TaskId> pending_ids_;
-  std::deque<TaskId> done_ids_;
-  std::unordered_map<std::uint64_t, std::shared_ptr<std::mutex> > serial_key_mu_;
+  TaskPool<TaskEntry> entry_pool_;
+  // 已完成任务的结果保留窗口（超出后最老的 TaskId 返回 kNotFound）。
+  static const std::size_t kMaxRetainedStates = 65536;
+  TaskSlotTable slots_;
+  StrandShard strands_[kStrandShards];
+  // 定时器状态受 timer_mu_ 保护；timer_count_ 供 TryCancel 无锁判断是否需要查表。
+  const std::chrono::steady_clock::time_point timer_epoch_;
+  std::mutex timer_mu_;
+  std::condition_variable timer_cv_;
+  std::thread timer_thread_;               // 首次提交定时任务时创建
+  bool timer_stopping_;
+  std::uint64_t timer_wake_tick_;          // 定时线程休眠到的 tick；0 = 未休眠
+  std::atomic<std::size_t> timer_count_;
+  TimerWheel timer_wheel_;
+  std::unordered_map<TaskId, std::shared_ptr<TimerTask> > timers_;
 };
 
 }  // namespace task
@@ -0,0 +1,132 @@
+#include "task/timer_wheel.hpp"
+
+#include <limits>
+
+namespace corekit {
+namespace task {
+
+namespace {
+
+const std::uint64_t kSlotMask = TimerWheel::kSlots - 1;
+
+}  // namespace
+
+TimerWheel::TimerWheel(std::uint64_t now_tick) : now_(now_tick), size_(0), overflow_(NULL) {
+  for (std::uint32_t level = 0; level <= kLevels; ++level) level_count_[level] = 0;
+  for (std::uint32_t level = 0; level < kLevels; ++level) {
+    for (std::uint32_t slot = 0; slot < kSlots; ++slot) slots_[level][slot] = NULL;
+  }
+}
+
+void TimerWheel::Schedule(Node* node, std::uint64_t expiry) {
+  node->expiry = expiry > now_ ? expiry : now_ + 1;
+  Place(node);
+  ++size_;
+}
+
+bool TimerWheel::Cancel(Node* node) {
+  if (node->bucket == NULL) return false;
+  Unlink(node);
+  --size_;
+  return true;
+}
+
+void TimerWheel::Advance(std::uint64_t now_tick, std::vector<Node*>* expired) {
+  while (now_ < now_tick) {
+    if (size_ == 0) {
+      now_ = now_tick;
+      return;
+    }
+    // 低 k 层全空时，在第 k 层的下一个边界之前不会有节点到期或需要 cascade。
+    std::uint64_t next = now_ + 1;
+    for (std::uint32_t k = 1; k <= kLevels && level_count_[k - 1] == 0; ++k) {
+      const std::uint32_t shift = k * kSlotBits;
+      next = ((now_ >> shift) + 1) << shift;
+    }
+    if (next > now_tick) {
+      now_ = now_tick;
+      return;
+    }
+    now_ = next;
+
+    // 自顶向下 cascade，使同一 tick 到期的节点一路落到第 0 层的当前槽位。
+    const std::uint32_t top_shift = kLevels * kSlotBits;
+    if ((now_ & ((1ull << top_shift) - 1)) == 0) Cascade(&overflow_);
+    for (std::uint32_t level = kLevels - 1; level >= 1; --level) {
+      const std::uint32_t shift = level * kSlotBits;
+      if ((now_ & ((1ull << shift) - 1)) == 0) {
+        Cascade(&slots_[level][(now_ >> shift) & kSlotMask]);
+      }
+    }
+
+    Node** bucket = &slots_[0][now_ & kSlotMask];
+    while (*bucket != NULL) {
+      Node* node = *bucket;
+      Unlink(node);
+      --size_;
+      expired->push_back(node);
+    }
+  }
+}
+
+std::uint64_t TimerWheel::NextWakeTick() const {
+  if (size_ == 0) return std::numeric_limits<std::uint64_t>::max();
+  // 低层槽位总是早于高层：第 L 层只存放当前 kSlots^(L+1) 块内、但不在当前 kSlots^L 块内的节点。
+  for (std::uint32_t level = 0; level < kLevels; ++level) {
+    if (level_count_[level] == 0) continue;
+    const std::uint32_t shift = level * kSlotBits;
+    const std::uint64_t block = (now_ >> (shift + kSlotBits)) << (shift + kSlotBits);
+    for (std::uint64_t slot = ((now_ >> shift) & kSlotMask) + 1; slot < kSlots; ++slot) {
+      if (slots_[level][slot] != NULL) return block | (slot << shift);
+    }
+  }
+  const std::uint32_t top_shift = kLevels * kSlotBits;
+  return ((now_ >> top_shift) + 1) << top_shift;
+}
+
+void TimerWheel::Place(Node* node) {
+  for (std::uint32_t level = 0; level < kLevels; ++level) {
+    const std::uint32_t block_shift = (level + 1) * kSlotBits;
+    if ((node->expiry >> block_shift) == (now_ >> block_shift)) {
+      Link(&slots_[level][(node->expiry >> (level * kSlotBits)) & kSlotMask], node, level);
+      return;
+    }
+  }
+  Link(&overflow_, node, kLevels);
+}
+
+void TimerWheel::Link(Node** bucket, Node* node, std::uint32_t level) {
+  node->bucket = bucket;
+  node->level = level;
+  node->prev = NULL;
+  node->next = *bucket;
+  if (*bucket != NULL) (*bucket)->prev = node;
+  *bucket = node;
+  ++level_count_[level];
+}
+
+void TimerWheel::Unlink(Node* node) {
+  if (node->prev != NULL) {
+    node->prev->next = node->next;
+  } else {
+    *node->bucket = node->next;
+  }
+  if (node->next != NULL) node->next->prev = node->prev;
+  --level_count_[node->level];
+  node->prev = NULL;
+  node->next = NULL;
+  node->bucket = NULL;
+}
+
+void TimerWheel::Cascade(Node** bucket) {
+  Node* node = *bucket;
+  while (node != NULL) {
+    Node* next = node->next;
+    Unlink(node);
+    Place(node);
+    node = next;
+  }
+}
+
+}  // namespace task
+}  // namespace corekit
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TimerWheel
+//
+// 分层时间轮：kLevels 层、每层 kSlots 个槽位，第 L 层一个槽位覆盖 kSlots^L 个 tick，
+// 合计覆盖 kSlots^kLevels 个 tick（1 ms/tick 时约 4.6 小时），更远的定时器放入溢出链表。
+// 低层转完一圈时把上一层当前槽位的节点按剩余时间重新分配到下层（cascade）。
+// 插入 / 取消均为 O(1)；推进时跳过空的低层，长时间空闲不会逐 tick 空转。
+//
+// 节点为侵入式双向链表，由调用方持有；本类不做同步，调用方负责加锁。
+// ─────────────────────────────────────────────────────────────────────────────
+class TimerWheel {
+ public:
+  static const std::uint32_t kSlotBits = 6;
+  static const std::uint32_t kSlots = 1u << kSlotBits;
+  static const std::uint32_t kLevels = 4;
+
+  struct Node {
+    std::uint64_t expiry = 0;  // 到期 tick
+    Node* prev = NULL;
+    Node* next = NULL;
+    Node** bucket = NULL;      // 所在链表头；NULL = 不在时间轮中
+    std::uint32_t level = 0;   // 所在层，kLevels = 溢出链表
+  };
+
+  explicit TimerWheel(std::uint64_t now_tick = 0);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // 插入节点，expiry 不晚于当前 tick 时在下一次推进时到期。节点不得已在时间轮中。
+  void Schedule(Node* node, std::uint64_t expiry);
+
+  // 移除节点；节点不在时间轮中时返回 false。
+  bool Cancel(Node* node);
+
+  // 推进到 now_tick，把到期节点（已移出时间轮）按到期顺序追加到 *expired。
+  void Advance(std::uint64_t now_tick, std::vector<Node*>* expired);
+
+  // 下一次需要推进的 tick（最早到期或需要 cascade 的时刻，不晚于最早的到期时间）；
+  // 时间轮为空时返回 UINT64_MAX。
+  std::uint64_t NextWakeTick() const;
+
+  std::uint64_t Now() const { return now_; }
+  std::size_t Size() const { return size_; }
+
+ private:
+  void Place(Node* node);
+  void Link(Node** bucket, Node* node, std::uint32_t level);
+  void Unlink(Node* node);
+  void Cascade(Node** bucket);
+
+  std::uint64_t now_;
+  std::size_t size_;
+  std::size_t level_count_[kLevels + 1];  // 各层节点数，下标 kLevels 为溢出链表
+  Node* slots_[kLevels][kSlots];
+  Node* overflow_;
+};
+
+}  // namespace task
+}  // namespace corekit
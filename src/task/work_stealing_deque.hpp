@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace corekit {
+namespace task {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// WorkStealingDeque
+//
+// Chase-Lev 无锁双端队列（参考 Lê/Pop/Cohen/Zappa Nardelli, PPoPP'13 的 C11 版本）。
+//   - Push / Pop 只能由拥有者线程调用（LIFO 端，缓存友好）；
+//   - Steal 可由任意线程并发调用（FIFO 端）。
+// 环形缓冲区满时翻倍扩容；旧缓冲区可能仍被并发的 Steal 读取，
+// 因此保留到析构时统一释放。T 须为可平凡拷贝的小类型（通常是指针）。
+// ─────────────────────────────────────────────────────────────────────────────
+template <typename T>
+class WorkStealingDeque {
+ public:
+  static_assert(std::is_trivially_copyable<T>::value,
+                "WorkStealingDeque<T> requires a trivially copyable T");
+
+  explicit WorkStealingDeque(std::size_t initial_capacity = 256)
+      : top_(0), pad_(), bottom_(0), array_(new Array(RoundUpPow2(initial_capacity))) {}
+
+  ~WorkStealingDeque() {
+    delete array_.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < retired_.size(); ++i) delete retired_[i];
+  }
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  // 拥有者线程压入一个元素。
+  void Push(T value) {
+    const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+    const std::int64_t t = top_.load(std::memory_order_acquire);
+    Array* a = array_.load(std::memory_order_relaxed);
+    if (b - t > a->capacity - 1) {
+      a = Grow(a, b, t);
+    }
+    a->Put(b, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  // 拥有者线程从 LIFO 端取出一个元素。队列为空时返回 false。
+  bool Pop(T* out) {
+    const std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* a = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+    T value = a->Get(b);
+    if (t == b) {
+      // 仅剩最后一个元素：与 Steal 竞争 top_。
+      const bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      if (!won) return false;
+    }
+    *out = value;
+    return true;
+  }
+
+  // 任意线程从 FIFO 端窃取一个元素。队列为空或竞争失败时返回 false。
+  bool Steal(T* out) {
+    std::int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) return false;
+    Array* a = array_.load(std::memory_order_acquire);
+    T value = a->Get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    *out = value;
+    return true;
+  }
+
+  // 近似元素个数（并发场景下仅作提示）。
+  std::size_t SizeApprox() const {
+    const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+    const std::int64_t t = top_.load(std::memory_order_relaxed);
+    return b > t ? static_cast<std::size_t>(b - t) : 0;
+  }
+
+  bool EmptyApprox() const { return SizeApprox() == 0; }
+
+ private:
+  struct Array {
+    explicit Array(std::int64_t cap)
+        : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[static_cast<std::size_t>(cap)]) {}
+    ~Array() { delete[] slots; }
+
+    T Get(std::int64_t i) const {
+      return slots[static_cast<std::size_t>(i & mask)].load(std::memory_order_relaxed);
+    }
+    void Put(std::int64_t i, T value) {
+      slots[static_cast<std::size_t>(i & mask)].store(value, std::memory_order_relaxed);
+    }
+
+    const std::int64_t capacity;
+    const std::int64_t mask;
+    std::atomic<T>* slots;
+  };
+
+  static std::int64_t RoundUpPow2(std::size_t n) {
+    std::int64_t cap = 16;
+    while (cap < static_cast<std::int64_t>(n)) cap <<= 1;
+    return cap;
+  }
+
+  Array* Grow(Array* old, std::int64_t b, std::int64_t t) {
+    Array* bigger = new Array(old->capacity * 2);
+    for (std::int64_t i = t; i < b; ++i) bigger->Put(i, old->Get(i));
+    retired_.push_back(old);
+    array_.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  // top_ 与 bottom_ 分处不同缓存行，避免窃取者与拥有者之间的伪共享。
+  std::atomic<std::int64_t> top_;
+  char pad_[64 - sizeof(std::atomic<std::int64_t>)];
+  std::atomic<std::int64_t> bottom_;
+  std::atomic<Array*> array_;
+  std::vector<Array*> retired_;  // 仅拥有者线程访问
+};
+
+}  // namespace task
+}  // namespace corekit
@@ -0,0 +1,328 @@
+#include "corekit/corekit.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 执行器微基准：覆盖 ExecutorBackend × ExecutorPolicy 的全部组合，输出 CSV（默认）或 JSON，
+// 便于脚本比较不同后端 / 版本之间的回归。
+//
+// 用法：executor_bench [iterations] [csv|json]
+//   submit_latency    : 单个提交线程逐个提交空任务，记录提交 → 开始执行的延迟（p50 / p99 / mean）。
+//   empty_throughput  : worker_count 个提交线程并发提交空任务，WaitAll 结束计时；随线程数扩展。
+//   parallel_for      : ParallelFor(grain = 0) 处理 iterations 个元素；随线程数扩展。
+//   serial_key        : 64 个串行键轮流提交空任务，衡量 strand 交接开销。
+//   wait_batch        : 每轮 SubmitEx 64 个空任务再 WaitBatch，报告每轮平均耗时。
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+using corekit::task::ExecutorBackend;
+using corekit::task::ExecutorOptions;
+using corekit::task::ExecutorPolicy;
+using corekit::task::IExecutor;
+using corekit::task::TaskFunction;
+using corekit::task::TaskId;
+using corekit::task::TaskSubmitOptions;
+
+struct Row {
+  std::string bench;
+  const char* backend;
+  const char* policy;
+  std::size_t workers;
+  std::size_t ops;
+  double seconds;
+  double mean_ns;
+  std::uint64_t p50_ns;
+  std::uint64_t p99_ns;
+};
+
+const std::size_t kSerialKeys = 64;
+const std::size_t kWaitBatchSize = 64;
+
+std::uint64_t NowNanos() {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+          .count());
+}
+
+double SecondsSince(const Clock::time_point& start) {
+  return std::chrono::duration_cast<std::chrono::duration<double> >(Clock::now() - start).count();
+}
+
+const char* BackendName(ExecutorBackend b) {
+  switch (b) {
+    case ExecutorBackend::kSharedQueue:
+      return "shared_queue";
+    case ExecutorBackend::kWorkStealing:
+      return "work_stealing";
+    default:
+      return "unknown";
+  }
+}
+
+const char* PolicyName(ExecutorPolicy p) {
+  switch (p) {
+    case ExecutorPolicy::kFifo:
+      return "fifo";
+    case ExecutorPolicy::kPriority:
+      return "priority";
+    case ExecutorPolicy::kFair:
+      return "fair";
+    case ExecutorPolicy::kHybridFairPriority:
+      return "hybrid";
+    default:
+      return "unknown";
+  }
+}
+
+IExecutor* CreateExecutor(ExecutorBackend backend, ExecutorPolicy policy, std::size_t workers) {
+  ExecutorOptions opt;
+  opt.worker_count = workers;
+  opt.backend = backend;
+  opt.policy = policy;
+  return corekit_create_executor_v2(&opt);
+}
+
+Row MakeRow(const char* bench, ExecutorBackend backend, ExecutorPolicy policy,
+            std::size_t workers, std::size_t ops, double seconds) {
+  Row row;
+  row.bench = bench;
+  row.backend = BackendName(backend);
+  row.policy = PolicyName(policy);
+  row.workers = workers;
+  row.ops = ops;
+  row.seconds = seconds;
+  row.mean_ns = ops > 0 ? seconds * 1e9 / static_cast<double>(ops) : 0.0;
+  row.p50_ns = 0;
+  row.p99_ns = 0;
+  return row;
+}
+
+bool BenchSubmitLatency(ExecutorBackend backend, ExecutorPolicy policy, std::size_t workers,
+                        std::size_t samples, std::vector<Row>* rows) {
+  IExecutor* exec = CreateExecutor(backend, policy, workers);
+  if (exec == NULL) return false;
+
+  // 每次只有一个任务在途，测的是空闲执行器上的唤醒 + 出队延迟，不含排队。
+  std::vector<std::uint64_t> lat(samples, 0);
+  std::atomic<std::uint64_t> ran_at(0);
+  bool ok = true;
+  const Clock::time_point begin = Clock::now();
+  for (std::size_t i = 0; i < samples && ok; ++i) {
+    ran_at.store(0, std::memory_order_relaxed);
+    const std::uint64_t submit_at = NowNanos();
+    ok = exec->Submit([&ran_at]() { ran_at.store(NowNanos(), std::memory_order_release); }).ok();
+    std::uint64_t t = 0;
+    while (ok && (t = ran_at.load(std::memory_order_acquire)) == 0) std::this_thread::yield();
+    lat[i] = t > submit_at ? t - submit_at : 0;
+  }
+  const double seconds = SecondsSince(begin);
+  ok = exec->WaitAll().ok() && ok;
+  corekit_destroy_executor(exec);
+  if (!ok || samples == 0) return ok;
+
+  Row row = MakeRow("submit_latency", backend, policy, workers, samples, seconds);
+  double sum = 0.0;
+  for (std::size_t i = 0; i < samples; ++i) sum += static_cast<double>(lat[i]);
+  row.mean_ns = sum / static_cast<double>(samples);
+  std::sort(lat.begin(), lat.end());
+  row.p50_ns = lat[samples / 2];
+  row.p99_ns = lat[std::min(samples - 1, samples * 99 / 100)];
+  rows->push_back(row);
+  return true;
+}
+
+bool BenchEmptyThroughput(ExecutorBackend backend, ExecutorPolicy policy, std::size_t workers,
+                          std::size_t tasks, std::vector<Row>* rows) {
+  IExecutor* exec = CreateExecutor(backend, policy, workers);
+  if (exec == NULL) return false;
+
+  // 提交线程数与工作线程数相同，提交端与消费端同时随线程数增加争用。
+  const std::size_t producers = workers;
+  const std::size_t per_producer = tasks / producers;
+  std::atomic<bool> go(false);
+  std::atomic<bool> ok(true);
+  std::vector<std::thread> threads;
+  for (std::size_t p = 0; p < producers; ++p) {
+    threads.push_back(std::thread([exec, per_producer, &go, &ok]() {
+      while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+      for (std::size_t i = 0; i < per_producer; ++i) {
+        if (!exec->SubmitTask(TaskFunction([]() {}), TaskSubmitOptions(), NULL).ok()) {
+          ok.store(false);
+          return;
+        }
+      }
+    }));
+  }
+  const Clock::time_point begin = Clock::now();
+  go.store(true, std::memory_order_release);
+  for (std::size_t p = 0; p < threads.size(); ++p) threads[p].join();
+  const bool waited = exec->WaitAll().ok();
+  const double seconds = SecondsSince(begin);
+  corekit_destroy_executor(exec);
+  if (!ok.load() || !waited) return false;
+
+  rows->push_back(
+      MakeRow("empty_throughput", backend, policy, workers, per_producer * producers, seconds));
+  return true;
+}
+
+bool BenchParallelFor(ExecutorBackend backend, ExecutorPolicy policy, std::size_t workers,
+                      std::size_t elements, std::vector<Row>* rows) {
+  IExecutor* exec = CreateExecutor(backend, policy, workers);
+  if (exec == NULL) return false;
+
+  std::vector<std::uint32_t> data(elements, 1);
+  const Clock::time_point begin = Clock::now();
+  const bool ok = exec->ParallelFor(0, elements, 0, [&data](std::size_t i) {
+                        data[i] = data[i] * 2654435761u + static_cast<std::uint32_t>(i);
+                      }).ok();
+  const double seconds = SecondsSince(begin);
+  corekit_destroy_executor(exec);
+  if (!ok) return false;
+
+  rows->push_back(MakeRow("parallel_for", backend, policy, workers, elements, seconds));
+  return true;
+}
+
+bool BenchSerialKey(ExecutorBackend backend, ExecutorPolicy policy, std::size_t workers,
+                    std::size_t tasks, std::vector<Row>* rows) {
+  IExecutor* exec = CreateExecutor(backend, policy, workers);
+  if (exec == NULL) return false;
+
+  bool ok = true;
+  TaskSubmitOptions opt;
+  const Clock::time_point begin = Clock::now();
+  for (std::size_t i = 0; i < tasks && ok; ++i) {
+    opt.serial_key = 1 + i % kSerialKeys;
+    ok = exec->SubmitTask(TaskFunction([]() {}), opt, NULL).ok();
+  }
+  ok = exec->WaitAll().ok() && ok;
+  const double seconds = SecondsSince(begin);
+  corekit_destroy_executor(exec);
+  if (!ok) return false;
+
+  rows->push_back(MakeRow("serial_key", backend, policy, workers, tasks, seconds));
+  return true;
+}
+
+bool BenchWaitBatch(ExecutorBackend backend, ExecutorPolicy policy, std::size_t workers,
+                    std::size_t tasks, std::vector<Row>* rows) {
+  IExecutor* exec = CreateExecutor(backend, policy, workers);
+  if (exec == NULL) return false;
+
+  const std::size_t rounds = std::max<std::size_t>(1, tasks / kWaitBatchSize);
+  std::vector<TaskId> ids(kWaitBatchSize, 0);
+  bool ok = true;
+  const Clock::time_point begin = Clock::now();
+  for (std::size_t r = 0; r < rounds && ok; ++r) {
+    for (std::size_t i = 0; i < kWaitBatchSize && ok; ++i) {
+      corekit::api::Result<TaskId> id = exec->SubmitEx([]() {}, TaskSubmitOptions());
+      ok = id.ok();
+      if (ok) ids[i] = id.value();
+    }
+    ok = ok && exec->WaitBatch(&ids[0], ids.size(), 0).ok();
+  }
+  const double seconds = SecondsSince(begin);
+  ok = exec->WaitAll().ok() && ok;
+  corekit_destroy_executor(exec);
+  if (!ok) return false;
+
+  // ops 为轮数，mean_ns 即一轮（64 次 SubmitEx + 一次 WaitBatch）的平均耗时。
+  rows->push_back(MakeRow("wait_batch", backend, policy, workers, rounds, seconds));
+  return true;
+}
+
+void PrintCsv(const std::vector<Row>& rows) {
+  std::printf("bench,backend,policy,workers,ops,seconds,ops_per_sec,mean_ns,p50_ns,p99_ns\n");
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    const Row& r = rows[i];
+    const double ops_per_sec = r.seconds > 0.0 ? static_cast<double>(r.ops) / r.seconds : 0.0;
+    std::printf("%s,%s,%s,%zu,%zu,%.6f,%.2f,%.1f,%llu,%llu\n", r.bench.c_str(), r.backend,
+                r.policy, r.workers, r.ops, r.seconds, ops_per_sec, r.mean_ns,
+                static_cast<unsigned long long>(r.p50_ns),
+                static_cast<unsigned long long>(r.p99_ns));
+  }
+}
+
+void PrintJson(const std::vector<Row>& rows) {
+  std::printf("[\n");
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    const Row& r = rows[i];
+    const double ops_per_sec = r.seconds > 0.0 ? static_cast<double>(r.ops) / r.seconds : 0.0;
+    std::printf(
+        "  {\"bench\": \"%s\", \"backend\": \"%s\", \"policy\": \"%s\", \"workers\": %zu, "
+        "\"ops\": %zu, \"seconds\": %.6f, \"ops_per_sec\": %.2f, \"mean_ns\": %.1f, "
+        "\"p50_ns\": %llu, \"p99_ns\": %llu}%s\n",
+        r.bench.c_str(), r.backend, r.policy, r.workers, r.ops, r.seconds, ops_per_sec,
+        r.mean_ns, static_cast<unsigned long long>(r.p50_ns),
+        static_cast<unsigned long long>(r.p99_ns), i + 1 < rows.size() ? "," : "");
+  }
+  std::printf("]\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t iterations = 200000;
+  bool json = false;
+  if (argc > 1) {
+    const long long n = std::atoll(argv[1]);
+    if (n > 0) iterations = static_cast<std::size_t>(n);
+  }
+  if (argc > 2) {
+    if (std::strcmp(argv[2], "json") == 0) {
+      json = true;
+    } else if (std::strcmp(argv[2], "csv") != 0) {
+      std::fprintf(stderr, "usage: %s [iterations] [csv|json]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  // 线程数扫描 1, 2, 4, ... 直到硬件并发数（至少扫到 4，观察超订时的表现）。
+  const std::size_t hw = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  std::vector<std::size_t> worker_counts;
+  for (std::size_t w = 1; w < std::max<std::size_t>(hw, 4); w *= 2) worker_counts.push_back(w);
+  worker_counts.push_back(std::max<std::size_t>(hw, 4));
+  const std::size_t latency_samples = std::max<std::size_t>(100, iterations / 20);
+
+  const ExecutorBackend backends[] = {ExecutorBackend::kSharedQueue,
+                                      ExecutorBackend::kWorkStealing};
+  const ExecutorPolicy policies[] = {ExecutorPolicy::kFifo, ExecutorPolicy::kPriority,
+                                     ExecutorPolicy::kFair, ExecutorPolicy::kHybridFairPriority};
+
+  std::vector<Row> rows;
+  for (std::size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); ++b) {
+    for (std::size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); ++p) {
+      const ExecutorBackend backend = backends[b];
+      const ExecutorPolicy policy = policies[p];
+      bool ok = BenchSubmitLatency(backend, policy, hw, latency_samples, &rows);
+      for (std::size_t w = 0; w < worker_counts.size() && ok; ++w) {
+        ok = BenchEmptyThroughput(backend, policy, worker_counts[w], iterations, &rows) &&
+             BenchParallelFor(backend, policy, worker_counts[w], iterations, &rows);
+      }
+      ok = ok && BenchSerialKey(backend, policy, hw, iterations, &rows) &&
+           BenchWaitBatch(backend, policy, hw, iterations, &rows);
+      if (!ok) {
+        std::fprintf(stderr, "executor bench failed: backend=%s policy=%s\n",
+                     BackendName(backend), PolicyName(policy));
+        return 1;
+      }
+    }
+  }
+
+  if (json) {
+    PrintJson(rows);
+  } else {
+    PrintCsv(rows);
+  }
+  return 0;
+}
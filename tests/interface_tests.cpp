@@ -5,18 +5,110 @@
 #include "src/concurrent/basic_set_impl.hpp"
 #include "src/concurrent/moodycamel_queue_impl.hpp"
 #include "src/memory/basic_object_pool_impl.hpp"
+#include "src/task/cpu_topology.hpp"
+#include "src/task/mpmc_queue.hpp"
+#include "src/task/timer_wheel.hpp"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <cstdio>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <mutex>
+#include <new>
+#include <stdexcept>
 #include <string>
 #include <thread>
 #include <vector>
 
+// 可开关的全局堆分配计数，用于验证执行器稳态零分配路径。
+// Windows DLL 不共享可替换的 operator new，该计数仅在非 Windows 平台生效。
+namespace {
+std::atomic<bool> g_count_allocs(false);
+std::atomic<long> g_alloc_count(0);
+}  // namespace
+
+#if !defined(_WIN32)
+#if defined(__GNUC__)
+#define COREKIT_TEST_NOINLINE __attribute__((noinline))
+#else
+#define COREKIT_TEST_NOINLINE
+#endif
+
+namespace {
+
+// 替换全部形式的 operator new / delete，统一经这两个函数分配与释放。二者不内联：
+// 否则编译器会把内联后的 free 与调用处的 new 表达式配对，误报 -Wmismatched-new-delete。
+COREKIT_TEST_NOINLINE void* CountedAlloc(std::size_t size, std::size_t align) noexcept {
+  if (g_count_allocs.load(std::memory_order_relaxed)) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (size == 0) size = 1;
+  if (align <= alignof(std::max_align_t)) return std::malloc(size);
+  void* p = NULL;
+  return posix_memalign(&p, align, size) == 0 ? p : NULL;
+}
+
+COREKIT_TEST_NOINLINE void CountedFree(void* p) noexcept { std::free(p); }
+
+void* CountedAllocOrThrow(std::size_t size, std::size_t align) {
+  void* p = CountedAlloc(size, align);
+  if (p == NULL) throw std::bad_alloc();
+  return p;
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) { return CountedAllocOrThrow(size, 0); }
+void* operator new[](std::size_t size) { return CountedAllocOrThrow(size, 0); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return CountedAlloc(size, 0);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return CountedAlloc(size, 0);
+}
+void operator delete(void* p) noexcept { CountedFree(p); }
+void operator delete[](void* p) noexcept { CountedFree(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { CountedFree(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { CountedFree(p); }
+void operator delete(void* p, std::size_t) noexcept { CountedFree(p); }
+void operator delete[](void* p, std::size_t) noexcept { CountedFree(p); }
+
+#if defined(__cpp_aligned_new)
+void* operator new(std::size_t size, std::align_val_t align) {
+  return CountedAllocOrThrow(size, static_cast<std::size_t>(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+  return CountedAllocOrThrow(size, static_cast<std::size_t>(align));
+}
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+  return CountedAlloc(size, static_cast<std::size_t>(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+  return CountedAlloc(size, static_cast<std::size_t>(align));
+}
+void operator delete(void* p, std::align_val_t) noexcept { CountedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { CountedFree(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+  CountedFree(p);
+}
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+  CountedFree(p);
+}
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { CountedFree(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { CountedFree(p); }
+#endif
+#endif
+
 bool TestApiVersion() {
   return corekit_get_api_version() == corekit::api::kApiVersion;
 }
@@ -117,6 +209,153 @@ bool TestExecutorParallelFor() {
   return sum.load(std::memory_order_relaxed) == 5050;
 }
 
+bool TestExecutorParallelForRange() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 4;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 自适应分块：每个下标恰好处理一次。
+  const std::size_t n = 100000;
+  std::vector<std::atomic<int> > hits(n);
+  for (std::size_t i = 0; i < n; ++i) hits[i].store(0);
+  bool ok = corekit::task::ParallelForRange(executor, 0, n, 0,
+                                            [&hits](std::size_t b, std::size_t e) {
+                                              for (std::size_t i = b; i < e; ++i) {
+                                                hits[i].fetch_add(1, std::memory_order_relaxed);
+                                              }
+                                            })
+                .ok();
+  for (std::size_t i = 0; i < n && ok; ++i) ok = hits[i].load() == 1;
+
+  // 固定分块：块大小不超过 grain。
+  std::atomic<bool> oversized(false);
+  std::atomic<long long> sum(0);
+  ok = executor->ParallelForRange(10, 1010, 7,
+                                  [&oversized, &sum](std::size_t b, std::size_t e) {
+                                    if (e - b > 7) oversized.store(true);
+                                    for (std::size_t i = b; i < e; ++i) sum.fetch_add(i);
+                                  })
+           .ok() &&
+       ok;
+  ok = !oversized.load() && sum.load() == 509500 && ok;
+
+  std::atomic<bool> thrown(false);
+  corekit::api::Status st = executor->ParallelForRange(0, 64, 1, [&thrown](std::size_t b, std::size_t) {
+    if (b == 13 && !thrown.exchange(true)) throw std::runtime_error("boom");
+  });
+  ok = st.code() == corekit::api::StatusCode::kInternalError && ok;
+  corekit_destroy_executor(executor);
+
+  // 调用线程参与执行：唯一的工作线程被占用时 ParallelForEach 仍能完成，
+  // 在工作线程内嵌套调用也不会死锁。
+  opt.worker_count = 1;
+  executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  std::atomic<bool> release(false);
+  corekit::task::SubmitLambda(executor, [&release]() {
+    while (!release.load()) std::this_thread::yield();
+  });
+  std::atomic<long long> each_sum(0);
+  ok = corekit::task::ParallelForEach(executor, 1, 101, 0,
+                                      [&each_sum](std::size_t i) { each_sum.fetch_add(i); })
+           .ok() &&
+       each_sum.load() == 5050 && ok;
+  release.store(true);
+
+  std::atomic<long long> nested_sum(0);
+  corekit::api::Result<corekit::task::TaskId> outer = executor->SubmitEx(
+      [executor, &nested_sum]() {
+        corekit::task::ParallelForEach(executor, 0, 1000, 10,
+                                       [&nested_sum](std::size_t i) { nested_sum.fetch_add(i); });
+      },
+      corekit::task::TaskSubmitOptions());
+  ok = outer.ok() && executor->Wait(outer.value(), 0).ok() && nested_sum.load() == 499500 && ok;
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorParallelReduceAndScan() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 4;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  opt.worker_count = 2;
+  corekit::task::IExecutor* narrow = corekit_create_executor_v2(&opt);
+  if (executor == NULL || narrow == NULL) return false;
+
+  std::vector<long long> values(100000);
+  for (std::size_t i = 0; i < values.size(); ++i) values[i] = static_cast<long long>(i + 1);
+  corekit::api::Result<long long> sum = corekit::task::ParallelReduce(
+      executor, values.begin(), values.end(), 5LL, std::plus<long long>());
+  bool ok = sum.ok() && sum.value() == 5000050005LL;
+
+  // 结合律成立但不可交换的运算：按块顺序合并才能得到正确结果。
+  std::vector<int> digits(1000);
+  for (std::size_t i = 0; i < digits.size(); ++i) digits[i] = static_cast<int>(i % 10);
+  corekit::api::Result<std::string> joined = corekit::task::ParallelTransformReduce(
+      executor, digits.begin(), digits.end(), std::string(">"),
+      [](const std::string& a, const std::string& b) { return a + b; },
+      [](int d) { return std::string(1, static_cast<char>('0' + d)); }, 16);
+  std::string expected(">");
+  for (std::size_t i = 0; i < digits.size(); ++i) expected += static_cast<char>('0' + i % 10);
+  ok = joined.ok() && joined.value() == expected && ok;
+
+  // 浮点结果与工作线程数无关（逐位相同）。
+  std::vector<double> reals(50000);
+  for (std::size_t i = 0; i < reals.size(); ++i) reals[i] = 1.0 / static_cast<double>(i + 1);
+  auto square = [](double x) { return x * x; };
+  corekit::api::Result<double> r4 = corekit::task::ParallelTransformReduce(
+      executor, reals.begin(), reals.end(), 0.0, std::plus<double>(), square);
+  corekit::api::Result<double> r2 = corekit::task::ParallelTransformReduce(
+      narrow, reals.begin(), reals.end(), 0.0, std::plus<double>(), square);
+  ok = r4.ok() && r2.ok() && r4.value() == r2.value() && ok;
+
+  std::vector<long long> scanned(values.size());
+  ok = corekit::task::ParallelInclusiveScan(executor, values.begin(), values.end(),
+                                            scanned.begin(), std::plus<long long>())
+           .ok() &&
+       ok;
+  for (std::size_t i = 0; i < scanned.size() && ok; ++i) {
+    const long long n = static_cast<long long>(i + 1);
+    ok = scanned[i] == n * (n + 1) / 2;
+  }
+  std::vector<long long> in_place(values.begin(), values.begin() + 1001);
+  ok = corekit::task::ParallelInclusiveScan(executor, in_place.begin(), in_place.end(),
+                                            in_place.begin(), std::plus<long long>(), 7)
+           .ok() &&
+       in_place.back() == 501501 && ok;
+
+  // 各块的部分和各占一条缓存行（C++14 下 std::vector 不保证超对齐，由 PartialArray 手动对齐）。
+  corekit::task::detail::PartialArray<char> partials(3, 'x');
+  for (std::size_t i = 0; i < 3; ++i) {
+    ok = reinterpret_cast<std::uintptr_t>(&partials[i]) % 64 == 0 && partials[i].value == 'x' &&
+         ok;
+  }
+
+  // 串行合并 / 前缀阶段在调用线程上执行，其中抛出的异常同样转为 kInternalError。
+  auto throw_on_negative = [](long long a, long long b) -> long long {
+    if (a < 0) throw std::runtime_error("negative accumulator");
+    return a + b;
+  };
+  corekit::api::Result<long long> bad_sum = corekit::task::ParallelReduce(
+      executor, values.begin(), values.end(), -1LL, throw_on_negative);
+  ok = !bad_sum.ok() &&
+       bad_sum.status().code() == corekit::api::StatusCode::kInternalError && ok;
+  // 元素均不超过 1000，只有块总和之间的前缀运算会触发异常。
+  auto throw_on_block_total = [](long long a, long long b) -> long long {
+    if (b > 1000) throw std::runtime_error("block total");
+    return a + b;
+  };
+  std::vector<long long> small(values.begin(), values.begin() + 1000);
+  corekit::api::Status bad_scan = corekit::task::ParallelInclusiveScan(
+      executor, small.begin(), small.end(), scanned.begin(), throw_on_block_total, 100);
+  ok = bad_scan.code() == corekit::api::StatusCode::kInternalError && ok;
+
+  corekit_destroy_executor(narrow);
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
 struct SerialTaskCtx {
   std::atomic<int>* running;
   std::atomic<int>* max_running;
@@ -199,6 +438,192 @@ bool TestExecutorSubmitExSerialKey() {
   return max_running.load(std::memory_order_relaxed) <= 1;
 }
 
+bool TestExecutorSerialKeyStrands() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 同键任务按提交顺序执行；排队中的同键任务不占用工作线程，其他任务可立即执行。
+  std::vector<int> order;
+  std::atomic<int> chain_done(0);
+  for (int i = 0; i < 20; ++i) {
+    corekit::api::Result<corekit::task::TaskId> r =
+        executor->SubmitWithKey(7, [&order, &chain_done, i]() {
+          std::this_thread::sleep_for(std::chrono::milliseconds(2));
+          order.push_back(i);
+          chain_done.fetch_add(1);
+        });
+    if (!r.ok()) return false;
+  }
+  std::atomic<int> seen_by_other(-1);
+  corekit::api::Result<corekit::task::TaskId> other = executor->SubmitEx(
+      [&seen_by_other, &chain_done]() { seen_by_other.store(chain_done.load()); },
+      corekit::task::TaskSubmitOptions());
+  bool ok = other.ok() && executor->Wait(other.value(), 0).ok();
+  ok = seen_by_other.load() >= 0 && seen_by_other.load() < 20 && ok;
+  ok = executor->WaitAll().ok() && ok;
+  ok = order.size() == 20 && ok;
+  for (std::size_t i = 0; i < order.size() && ok; ++i) ok = order[i] == static_cast<int>(i);
+
+  // 大量不同键：空闲键被回收，全部任务完成。
+  std::atomic<int> distinct(0);
+  for (std::uint64_t key = 1; key <= 50000 && ok; ++key) {
+    corekit::task::TaskSubmitOptions key_opt;
+    key_opt.serial_key = key;
+    ok = corekit::task::SubmitLambdaEx(executor, [&distinct]() { distinct.fetch_add(1); },
+                                       key_opt)
+             .ok();
+  }
+  ok = executor->WaitAll().ok() && distinct.load() == 50000 && ok;
+  corekit_destroy_executor(executor);
+
+  // 销毁执行器时仍在键队列中排队的任务会被执行完。
+  opt.worker_count = 1;
+  executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  std::atomic<int> drained(0);
+  for (int i = 0; i < 50; ++i) {
+    ok = executor->SubmitWithKey(3, [&drained]() { drained.fetch_add(1); }).ok() && ok;
+  }
+  corekit_destroy_executor(executor);
+  return ok && drained.load() == 50;
+}
+
+std::size_t LiveWorkers(corekit::task::IExecutor* executor) {
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  return stats.ok() ? stats.value().worker_count : 0;
+}
+
+// 轮询直到工作线程数等于 expected（最多约 2 秒）。
+bool WaitForLiveWorkers(corekit::task::IExecutor* executor, std::size_t expected) {
+  for (int i = 0; i < 400; ++i) {
+    if (LiveWorkers(executor) == expected) return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return false;
+}
+
+bool TestExecutorDynamicScaling() {
+  // 固定线程池：Reconfigure 的 worker_count 生效。
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  bool ok = LiveWorkers(executor) == 2;
+  opt.worker_count = 4;
+  ok = executor->Reconfigure(opt).ok() && LiveWorkers(executor) == 4 && ok;
+  // 新建的选项只改队列容量：worker_count = 0 保持当前线程数。
+  corekit::task::ExecutorOptions queue_only;
+  queue_only.queue_capacity = 512;
+  ok = executor->Reconfigure(queue_only).ok() && ok;
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ok = LiveWorkers(executor) == 4 && ok;
+  opt.worker_count = 1;
+  ok = executor->Reconfigure(opt).ok() && WaitForLiveWorkers(executor, 1) && ok;
+  std::atomic<int> ran(0);
+  for (int i = 0; i < 100; ++i) corekit::task::SubmitLambda(executor, [&ran]() { ran++; });
+  ok = executor->WaitAll().ok() && ran.load() == 100 && ok;
+  opt.min_workers = 3;
+  opt.max_workers = 2;
+  ok = executor->Reconfigure(opt).code() == corekit::api::StatusCode::kInvalidArgument && ok;
+  corekit_destroy_executor(executor);
+
+  // 弹性模式：积压时扩容到 max_workers，空闲超时后缩回 min_workers。
+  opt.worker_count = 1;
+  opt.min_workers = 1;
+  opt.max_workers = 4;
+  opt.idle_timeout_ms = 20;
+  opt.spawn_queue_depth = 0;
+  executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  std::atomic<bool> release(false);
+  std::atomic<int> blocked_done(0);
+  for (int i = 0; i < 8; ++i) {
+    corekit::task::SubmitLambda(executor, [&release, &blocked_done]() {
+      while (!release.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      blocked_done++;
+    });
+  }
+  ok = WaitForLiveWorkers(executor, 4) && ok;
+  release.store(true);
+  ok = executor->WaitAll().ok() && blocked_done.load() == 8 && ok;
+  ok = WaitForLiveWorkers(executor, 1) && ok;
+
+  // min_workers = 0：空闲时缩到 0 个线程，新任务到来时按需拉起。
+  opt.min_workers = 0;
+  ok = executor->Reconfigure(opt).ok() && WaitForLiveWorkers(executor, 0) && ok;
+  corekit::api::Result<corekit::task::TaskId> wake =
+      executor->SubmitEx([]() {}, corekit::task::TaskSubmitOptions());
+  ok = wake.ok() && executor->Wait(wake.value(), 2000).ok() && ok;
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorAffinityPlacement() {
+  std::vector<std::uint32_t> parsed;
+  bool ok = corekit::task::ParseCpuList("0-3,8,10-11\n", &parsed) && parsed.size() == 7 &&
+            parsed[4] == 8 && parsed[6] == 11;
+  ok = !corekit::task::ParseCpuList("3-1", &parsed) && ok;
+  ok = !corekit::task::ParseCpuList("1,x", &parsed) && ok;
+  corekit::task::CpuTopology topo = corekit::task::CpuTopology::Detect();
+  ok = topo.CpuCount() > 0 && ok;
+
+  // 绑定到第一个可用 CPU：任务在该 CPU 上执行；节点提示越界时退回全局队列。
+  const std::uint32_t cpu = topo.nodes[0][0];
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  opt.affinity = corekit::task::AffinityPolicy::kCompact;
+  opt.cpus = &cpu;
+  opt.cpu_count = 1;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  std::atomic<int> pinned(0);
+  std::atomic<int> ran(0);
+  const std::int32_t hints[3] = {-1, 0, 64};
+  for (int h = 0; h < 3; ++h) {
+    corekit::task::TaskSubmitOptions sub;
+    sub.numa_node = hints[h];
+    corekit::task::SubmitLambdaEx(
+        executor,
+        [&pinned, &ran, cpu]() {
+#if defined(__linux__)
+          cpu_set_t set;
+          CPU_ZERO(&set);
+          if (sched_getaffinity(0, sizeof(set), &set) == 0 && CPU_COUNT(&set) == 1 &&
+              CPU_ISSET(cpu, &set)) {
+            pinned++;
+          }
+#else
+          pinned++;
+#endif
+          ran++;
+        },
+        sub);
+  }
+  ok = executor->WaitAll().ok() && ran.load() == 3 && pinned.load() == 3 && ok;
+  corekit_destroy_executor(executor);
+
+  // 按节点分子池 + 工作窃取：工作线程内带节点提示的提交也能完成。
+  opt.affinity = corekit::task::AffinityPolicy::kPerNode;
+  opt.backend = corekit::task::ExecutorBackend::kWorkStealing;
+  opt.cpus = NULL;
+  opt.cpu_count = 0;
+  executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  std::atomic<int> children(0);
+  corekit::task::SubmitLambda(executor, [executor, &children]() {
+    for (int i = 0; i < 32; ++i) {
+      corekit::task::TaskSubmitOptions sub;
+      sub.numa_node = i % 2;
+      corekit::task::SubmitLambdaEx(executor, [&children]() { children++; }, sub);
+    }
+  });
+  ok = executor->WaitAll().ok() && children.load() == 32 && ok;
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
 bool TestExecutorWaitAll() {
   corekit::task::ExecutorOptions opt;
   opt.worker_count = 4;
@@ -284,6 +709,1104 @@ bool TestExecutorPriorityPolicy() {
   return order[0] == 2 && order[1] == 1;
 }
 
+// 单工作线程被阻塞期间先提交 1 个 low，再提交 6 个 high；返回 low 的实际执行位置。
+int RunLowAmongHighs(corekit::task::ExecutorPolicy policy, std::uint32_t aging_threshold) {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 1;
+  opt.policy = policy;
+  opt.aging_threshold = aging_threshold;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return -1;
+
+  std::atomic<bool> release(false);
+  std::vector<int> order;
+  std::mutex order_mu;
+  BlockerCtx blocker_ctx = {&release};
+  if (!executor->Submit([&blocker_ctx]() { BlockingTask(&blocker_ctx); }).ok()) return -1;
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  std::vector<PriorityOrderCtx> ctxs;
+  ctxs.reserve(7);
+  for (int i = 0; i < 7; ++i) {
+    PriorityOrderCtx c = {&order, &order_mu, i == 0 ? 1 : 2};
+    ctxs.push_back(c);
+  }
+  for (int i = 0; i < 7; ++i) {
+    corekit::task::TaskSubmitOptions sopt;
+    sopt.priority = i == 0 ? corekit::task::TaskPriority::kLow : corekit::task::TaskPriority::kHigh;
+    PriorityOrderCtx* c = &ctxs[static_cast<std::size_t>(i)];
+    if (!executor->SubmitEx([c]() { PriorityProbeTask(c); }, sopt).ok()) return -1;
+  }
+
+  release.store(true, std::memory_order_release);
+  executor->WaitAll();
+  corekit_destroy_executor(executor);
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    if (order[i] == 1) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+bool TestExecutorHybridAging() {
+  // kPriority：low 被所有 high 越过，最后执行。
+  if (RunLowAmongHighs(corekit::task::ExecutorPolicy::kPriority, 2) != 6) return false;
+  // kHybridFairPriority：每被越过 2 次提升一级，被越过 4 次后与 high 同级，按入队先后胜出。
+  return RunLowAmongHighs(corekit::task::ExecutorPolicy::kHybridFairPriority, 2) == 4;
+}
+
+bool TestExecutorWorkStealingBackend() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 4;
+  opt.backend = corekit::task::ExecutorBackend::kWorkStealing;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  if (std::strcmp(executor->Name(), "corekit.task.work_stealing_executor") != 0) return false;
+
+  // 根任务在工作线程内扇出子任务（进入本地队列），随后自身阻塞，
+  // 其余空闲工作线程只能通过窃取来执行这些子任务。
+  std::atomic<int> done(0);
+  std::atomic<bool> spawn_ok(true);
+  const int kChildren = 64;
+  auto root = [executor, &done, &spawn_ok]() {
+    for (int i = 0; i < kChildren; ++i) {
+      if (!executor->Submit([&done]() { done.fetch_add(1, std::memory_order_relaxed); }).ok()) {
+        spawn_ok.store(false);
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  };
+  if (!executor->Submit(root).ok()) return false;
+  if (!executor->WaitAll().ok()) return false;
+
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  corekit_destroy_executor(executor);
+  if (!stats.ok() || !spawn_ok.load()) return false;
+  return done.load(std::memory_order_relaxed) == kChildren &&
+         stats.value().completed == static_cast<std::uint64_t>(kChildren + 1) &&
+         stats.value().stolen > 0;
+}
+
+bool TestExecutorWaitStrategies() {
+  const corekit::task::WaitStrategy strategies[] = {corekit::task::WaitStrategy::kBlocking,
+                                                     corekit::task::WaitStrategy::kSpinThenPark,
+                                                     corekit::task::WaitStrategy::kBusyPoll};
+  const corekit::task::ExecutorBackend backends[] = {
+      corekit::task::ExecutorBackend::kSharedQueue,
+      corekit::task::ExecutorBackend::kWorkStealing};
+  bool ok = true;
+  for (std::size_t s = 0; s < 3; ++s) {
+    for (std::size_t b = 0; b < 2; ++b) {
+      corekit::task::ExecutorOptions opt;
+      opt.worker_count = 2;
+      opt.backend = backends[b];
+      opt.wait_strategy = strategies[s];
+      opt.spin_count = 256;
+      opt.yield_count = 4;
+      corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+      if (executor == NULL) return false;
+
+      // 外部提交与工作线程内嵌套提交交替，间歇停顿让线程进入自旋/休眠后再被唤醒。
+      std::atomic<int> done(0);
+      for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 10; ++i) {
+          ok = executor->Submit([executor, &done]() {
+                 done.fetch_add(1);
+                 executor->Submit([&done]() { done.fetch_add(1); });
+               }).ok() &&
+               ok;
+        }
+        if (round % 5 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      ok = executor->WaitAll().ok() && ok;
+      ok = done.load() == 400 && ok;
+
+      // 运行时切换策略：忙轮询线程须能退回休眠，之后仍可正常执行任务。
+      opt.wait_strategy = strategies[(s + 1) % 3];
+      ok = executor->Reconfigure(opt).ok() && ok;
+      corekit::api::Result<corekit::task::TaskId> id =
+          executor->SubmitEx([&done]() { done.fetch_add(1); }, corekit::task::TaskSubmitOptions());
+      ok = id.ok() && executor->Wait(id.value(), 0).ok() && done.load() == 401 && ok;
+      corekit_destroy_executor(executor);
+    }
+  }
+  return ok;
+}
+
+bool TestExecutorSubmitTaskInline() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 仅可移动的捕获 + TaskId 跟踪。
+  std::atomic<int> moved_value(0);
+  std::unique_ptr<int> payload(new int(42));
+  corekit::api::Result<corekit::task::TaskId> tracked = corekit::task::SubmitLambdaEx(
+      executor,
+      [&moved_value, p = std::move(payload)]() { moved_value.store(*p); },
+      corekit::task::TaskSubmitOptions());
+  if (!tracked.ok() || !executor->Wait(tracked.value(), 0).ok()) return false;
+  corekit::api::Result<bool> succeeded = executor->IsTaskSucceeded(tracked.value());
+  if (!succeeded.ok() || !succeeded.value() || moved_value.load() != 42) return false;
+
+  std::atomic<int> counter(0);
+  auto inc = [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); };
+  if (!corekit::task::TaskFunction(inc).IsInline()) return false;
+
+  // 预热：填充任务槽池。
+  for (int i = 0; i < 2000; ++i) {
+    if (!corekit::task::SubmitLambda(executor, inc).ok()) return false;
+  }
+  if (!executor->WaitAll().ok()) return false;
+
+  g_alloc_count.store(0);
+  g_count_allocs.store(true);
+  bool submit_ok = true;
+  for (int i = 0; i < 1000; ++i) {
+    submit_ok = corekit::task::SubmitLambda(executor, inc).ok() && submit_ok;
+  }
+  executor->WaitAll();
+  g_count_allocs.store(false);
+
+  corekit_destroy_executor(executor);
+  if (!submit_ok || counter.load() != 3000) return false;
+#if !defined(_WIN32)
+  if (g_alloc_count.load() != 0) return false;
+#endif
+  return true;
+}
+
+bool TestExecutorTaskIdLifecycle() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 1;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  std::atomic<bool> release(false);
+  corekit::api::Result<corekit::task::TaskId> blocker = executor->SubmitEx(
+      [&release]() {
+        while (!release.load()) std::this_thread::yield();
+      },
+      corekit::task::TaskSubmitOptions());
+  corekit::api::Result<corekit::task::TaskId> victim =
+      executor->SubmitEx([]() {}, corekit::task::TaskSubmitOptions());
+  if (!blocker.ok() || !victim.ok()) return false;
+
+  const corekit::task::TaskId forged = victim.value() ^ (1ull << 32);
+  bool ok = executor->Wait(blocker.value(), 5).code() == corekit::api::StatusCode::kWouldBlock;
+  ok = executor->TryCancel(victim.value()).ok() && ok;
+  ok = executor->TryCancel(victim.value()).ok() && ok;  // 重复取消幂等
+  ok = executor->TryCancel(forged).code() == corekit::api::StatusCode::kNotFound && ok;
+  ok = executor->Wait(0, 0).code() == corekit::api::StatusCode::kNotFound && ok;
+  release.store(true);
+  ok = executor->Wait(victim.value(), 0).ok() && executor->Wait(blocker.value(), 0).ok() && ok;
+  ok = executor->TryCancel(blocker.value()).code() == corekit::api::StatusCode::kWouldBlock &&
+       ok;
+  corekit::api::Result<bool> victim_ok = executor->IsTaskSucceeded(victim.value());
+  ok = victim_ok.ok() && !victim_ok.value() && ok;
+  ok = executor->IsTaskSucceeded(forged).status().code() == corekit::api::StatusCode::kNotFound && ok;
+
+  // 保留窗口有界：大量后续已完成任务之后，最老的 ID 过期。
+  for (int wave = 0; wave < 70 && ok; ++wave) {
+    for (int i = 0; i < 1000 && ok; ++i) {
+      ok = executor->SubmitEx([]() {}, corekit::task::TaskSubmitOptions()).ok();
+    }
+    ok = executor->WaitAll().ok() && ok;
+  }
+  ok = executor->IsTaskSucceeded(blocker.value()).status().code() ==
+           corekit::api::StatusCode::kNotFound &&
+       ok;
+
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  corekit_destroy_executor(executor);
+  return ok && stats.ok() && stats.value().canceled == 1;
+}
+
+bool TestExecutorWaitBatchLatch() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 4;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  std::atomic<bool> release(false);
+  std::vector<corekit::task::TaskId> ids;
+  for (int i = 0; i < 32; ++i) {
+    corekit::api::Result<corekit::task::TaskId> r = executor->SubmitEx(
+        [&release, i]() {
+          while (i % 2 == 0 && !release.load()) std::this_thread::yield();
+        },
+        corekit::task::TaskSubmitOptions());
+    if (!r.ok()) return false;
+    ids.push_back(r.value());
+  }
+
+  // 超时后闩被收回，之后任务完成不得再触碰已出栈的闩。
+  bool ok = executor->WaitBatch(&ids[0], ids.size(), 10).code() ==
+            corekit::api::StatusCode::kWouldBlock;
+
+  // 多个批量等待/单个等待同时挂在同一批任务上。
+  std::atomic<int> woke(0);
+  std::vector<std::thread> waiters;
+  for (int t = 0; t < 3; ++t) {
+    waiters.emplace_back([executor, &ids, &woke]() {
+      if (executor->WaitBatch(&ids[0], ids.size(), 0).ok()) woke.fetch_add(1);
+    });
+  }
+  waiters.emplace_back([executor, &ids, &woke]() {
+    if (executor->Wait(ids[0], 0).ok()) woke.fetch_add(1);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  release.store(true);
+  for (std::size_t t = 0; t < waiters.size(); ++t) waiters[t].join();
+  ok = woke.load() == 4 && ok;
+
+  const corekit::task::TaskId unknown = ids[0] ^ (1ull << 32);
+  corekit::task::TaskId mixed[2] = {ids[1], unknown};
+  ok = executor->WaitBatch(mixed, 2, 0).code() == corekit::api::StatusCode::kNotFound && ok;
+  ok = executor->WaitBatch(&ids[0], ids.size(), 1).ok() && ok;
+
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorSubmitBatch() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 4;
+  opt.queue_capacity = 64;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  std::atomic<int> sum(0);
+  std::vector<corekit::task::TaskFunction> fns;
+  for (int i = 1; i <= 32; ++i) {
+    fns.push_back(corekit::task::TaskFunction([&sum, i]() { sum.fetch_add(i); }));
+  }
+  std::vector<corekit::task::TaskId> ids(fns.size(), 0);
+  bool ok = executor->SubmitBatch(&fns[0], fns.size(), corekit::task::TaskSubmitOptions(),
+                                  &ids[0]).ok();
+  ok = !fns[0] && ok;
+  ok = executor->WaitBatch(&ids[0], ids.size(), 0).ok() && ok;
+  ok = sum.load() == 32 * 33 / 2 && ok;
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    corekit::api::Result<bool> r = executor->IsTaskSucceeded(ids[i]);
+    ok = r.ok() && r.value() && ok;
+  }
+
+  // 全有或全无：含空任务或超出容量时整批拒绝，且不消费 fns。
+  std::vector<corekit::task::TaskFunction> bad;
+  bad.push_back(corekit::task::TaskFunction([&sum]() { sum.fetch_add(1000); }));
+  bad.push_back(corekit::task::TaskFunction());
+  ok = executor->SubmitBatch(&bad[0], bad.size(), corekit::task::TaskSubmitOptions(), NULL)
+               .code() == corekit::api::StatusCode::kInvalidArgument &&
+       ok;
+  ok = static_cast<bool>(bad[0]) && ok;
+  std::vector<corekit::task::TaskFunction> big;
+  for (int i = 0; i < 65; ++i) big.push_back(corekit::task::TaskFunction([&sum]() { ++sum; }));
+  ok = executor->SubmitBatch(&big[0], big.size(), corekit::task::TaskSubmitOptions(), NULL)
+               .code() == corekit::api::StatusCode::kWouldBlock &&
+       ok;
+  ok = static_cast<bool>(big[64]) && ok;
+
+  // 同一串行键的整批任务按顺序执行。
+  std::vector<int> order;
+  std::vector<corekit::task::TaskFunction> serial;
+  for (int i = 0; i < 16; ++i) {
+    serial.push_back(corekit::task::TaskFunction([&order, i]() { order.push_back(i); }));
+  }
+  corekit::task::TaskSubmitOptions keyed;
+  keyed.serial_key = 7;
+  ok = executor->SubmitBatch(&serial[0], serial.size(), keyed, NULL).ok() && ok;
+  ok = executor->WaitAll().ok() && ok;
+  ok = order.size() == 16 && ok;
+  for (std::size_t i = 0; i < order.size(); ++i) ok = order[i] == static_cast<int>(i) && ok;
+
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  ok = stats.ok() && stats.value().submitted == 48 && stats.value().rejected == 65 && ok;
+  ok = sum.load() == 32 * 33 / 2 && ok;
+
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorTimers() {
+  // 时间轮：跨层 cascade 与溢出链表中的节点都恰好在到期 tick 触发。
+  corekit::task::TimerWheel wheel(5);
+  const std::uint64_t expiries[] = {6, 63, 64, 70, 4095, 4097, 300000, (1ull << 24) + 77,
+                                    (1ull << 26) + 3};
+  const std::size_t kNodes = sizeof(expiries) / sizeof(expiries[0]);
+  corekit::task::TimerWheel::Node nodes[kNodes + 1];
+  for (std::size_t i = 0; i < kNodes; ++i) wheel.Schedule(&nodes[i], expiries[i]);
+  wheel.Schedule(&nodes[kNodes], 5000);
+  bool ok = wheel.Cancel(&nodes[kNodes]) && !wheel.Cancel(&nodes[kNodes]);
+  std::size_t fired = 0;
+  std::vector<corekit::task::TimerWheel::Node*> expired;
+  while (wheel.Size() > 0) {
+    const std::uint64_t wake = wheel.NextWakeTick();
+    ok = wake > wheel.Now() && wake <= expiries[fired] && ok;
+    expired.clear();
+    wheel.Advance(wake, &expired);
+    for (std::size_t i = 0; i < expired.size(); ++i) {
+      ok = fired < kNodes && expired[i] == &nodes[fired] && wake == expiries[fired] && ok;
+      ++fired;
+    }
+    if (!ok) return false;
+  }
+  ok = fired == kNodes && ok;
+
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 延时任务不早于 delay 执行；到期前取消立即生效。
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::atomic<long long> ran_after_ms(-1);
+  corekit::api::Result<corekit::task::TaskId> delayed = executor->SubmitAfter(
+      20,
+      [&ran_after_ms, start]() {
+        ran_after_ms.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
+      },
+      corekit::task::TaskSubmitOptions());
+  std::atomic<bool> canceled_ran(false);
+  corekit::api::Result<corekit::task::TaskId> doomed = executor->SubmitAfter(
+      60000, [&canceled_ran]() { canceled_ran.store(true); }, corekit::task::TaskSubmitOptions());
+  ok = delayed.ok() && doomed.ok() && ok;
+  if (!ok) return false;
+  ok = executor->TryCancel(doomed.value()).ok() && ok;
+  ok = executor->Wait(doomed.value(), 1000).ok() && ok;
+  corekit::api::Result<bool> doomed_ok = executor->IsTaskSucceeded(doomed.value());
+  ok = doomed_ok.ok() && !doomed_ok.value() && ok;
+  ok = executor->Wait(delayed.value(), 5000).ok() && ran_after_ms.load() >= 20 && ok;
+
+  // 周期任务按周期重复执行，取消后 Wait 返回且不再执行。
+  std::atomic<int> ticks(0);
+  corekit::api::Result<corekit::task::TaskId> periodic = executor->SubmitEvery(
+      2, [&ticks]() { ticks.fetch_add(1); }, corekit::task::TaskSubmitOptions());
+  ok = periodic.ok() && ok;
+  if (!ok) return false;
+  for (int i = 0; i < 2000 && ticks.load() < 5; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ok = ticks.load() >= 5 && ok;
+  ok = executor->TryCancel(periodic.value()).ok() && ok;
+  ok = executor->Wait(periodic.value(), 1000).ok() && ok;
+  ok = executor->WaitAll().ok() && ok;
+  const int ticks_after_cancel = ticks.load();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  ok = ticks.load() == ticks_after_cancel && !canceled_ran.load() && ok;
+
+  ok = executor->SubmitEvery(0, []() {}, corekit::task::TaskSubmitOptions()).status().code() ==
+           corekit::api::StatusCode::kInvalidArgument &&
+       ok;
+  // 销毁时未到期的定时任务被取消，不等待到期。
+  ok = executor->SubmitAfter(60000, []() {}, corekit::task::TaskSubmitOptions()).ok() && ok;
+  ok = executor->SubmitEvery(60000, []() {}, corekit::task::TaskSubmitOptions()).ok() && ok;
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorFutureThen() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  opt.backend = corekit::task::ExecutorBackend::kWorkStealing;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 值沿延续链传递，类型可变；延续在工作线程上执行。
+  const std::thread::id caller = std::this_thread::get_id();
+  std::atomic<bool> on_worker(false);
+  corekit::task::Future<int> f = corekit::task::Async(executor, []() { return 6; });
+  corekit::task::Future<std::string> g =
+      f.Then([](const int& v) { return v * 7; }).Then([caller, &on_worker](const int& v) {
+        on_worker.store(std::this_thread::get_id() != caller);
+        return std::to_string(v);
+      });
+  corekit::api::Result<std::string> r = g.Get();
+  bool ok = r.ok() && r.value() == "42" && on_worker.load() && f.IsReady();
+
+  // 前驱已就绪时注册的延续立即提交；同一 Future 可挂多个延续。
+  std::atomic<int> side(0);
+  corekit::task::Future<void> a = f.Then([&side](const int& v) { side.fetch_add(v); });
+  corekit::task::Future<void> b = f.Then([&side](const int& v) { side.fetch_add(v); });
+  ok = a.Get().ok() && b.Get().ok() && side.load() == 12 && ok;
+
+  // 异常转为 kInternalError，失败沿链传递且跳过后续延续。
+  std::atomic<bool> skipped(true);
+  corekit::task::Future<int> failed =
+      corekit::task::Async(executor, []() -> int { throw std::runtime_error("boom"); })
+          .Then([&skipped](const int& v) {
+            skipped.store(false);
+            return v + 1;
+          });
+  ok = failed.Get().status().code() == corekit::api::StatusCode::kInternalError &&
+       skipped.load() && ok;
+
+  // 长延续链：每一环由上一环的完成线程提交，不占用阻塞线程。
+  corekit::task::Future<int> chain = corekit::task::MakeReadyFuture(executor, 0);
+  for (int i = 0; i < 1000; ++i) chain = chain.Then([](const int& v) { return v + 1; });
+  ok = chain.Wait(10000).ok() && chain.Get().value() == 1000 && ok;
+
+  // 令牌已取消 / 截止时间已过：不调用 fn，Future 以错误完成而不是永不就绪。
+  corekit::task::CancellationSource source;
+  source.Cancel();
+  corekit::task::TaskSubmitOptions canceled;
+  canceled.cancel_token = source.Token();
+  corekit::task::TaskSubmitOptions expired;
+  expired.deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
+  std::atomic<int> stale_calls(0);
+  corekit::task::Future<int> canceled_then =
+      f.Then([&stale_calls](const int& v) { return v + stale_calls.fetch_add(1); }, canceled);
+  corekit::task::Future<int> expired_then =
+      f.Then([&stale_calls](const int& v) { return v + stale_calls.fetch_add(1); }, expired);
+  corekit::task::Future<int> canceled_async =
+      corekit::task::Async(executor, [&stale_calls]() { return stale_calls.fetch_add(1); },
+                           canceled);
+  ok = canceled_then.Wait(5000).ok() && expired_then.Wait(5000).ok() &&
+       canceled_async.Wait(5000).ok() && ok;
+  ok = canceled_then.Get().status().code() == corekit::api::StatusCode::kInternalError &&
+       expired_then.Get().status().code() == corekit::api::StatusCode::kInternalError &&
+       canceled_async.Get().status().code() == corekit::api::StatusCode::kInternalError &&
+       stale_calls.load() == 0 && ok;
+
+  corekit::task::Future<int> empty;
+  ok = !empty.valid() && !empty.IsReady() &&
+       empty.Get().status().code() == corekit::api::StatusCode::kInvalidArgument && ok;
+  ok = corekit::task::Async(NULL, []() { return 1; }).Get().status().code() ==
+           corekit::api::StatusCode::kInvalidArgument &&
+       ok;
+
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorFutureLongInlineChain() {
+  // 队列已满时延续全部在完成前驱的线程上内联执行；长链不能随链长加深调用栈。
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 1;
+  opt.queue_capacity = 1;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  std::atomic<bool> started(false);
+  std::atomic<bool> release(false);
+  corekit::task::Future<int> head = corekit::task::Async(executor, [&started, &release]() {
+    started.store(true);
+    while (!release.load()) std::this_thread::yield();
+    return 0;
+  });
+  const int kLength = 200000;
+  corekit::task::Future<int> tail = head;
+  for (int i = 0; i < kLength; ++i) tail = tail.Then([](const int& v) { return v + 1; });
+
+  while (!started.load()) std::this_thread::yield();
+  bool ok = executor->Submit([]() {}).ok();
+  ok = !executor->Submit([]() {}).ok() && ok;
+  release.store(true);
+
+  corekit::api::Result<int> r = tail.Get();
+  ok = r.ok() && r.value() == kLength && ok;
+  ok = executor->WaitAll().ok() && ok;
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorLatencyStats() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 未开启时不计时。
+  bool ok = executor->Submit([]() {}).ok() && executor->WaitAll().ok();
+  corekit::api::Result<corekit::task::ExecutorLatencyStats> off = executor->QueryLatency();
+  ok = off.ok() && off.value().run.count == 0 && off.value().queue_wait.count == 0 && ok;
+
+  // 运行时开启：每个任务约 200us，执行耗时分位数应落在该量级，且单调不减。
+  opt.enable_latency_stats = true;
+  ok = executor->Reconfigure(opt).ok() && ok;
+  const int kTasks = 100;
+  for (int i = 0; i < kTasks; ++i) {
+    ok = executor->Submit([]() {
+           const std::chrono::steady_clock::time_point until =
+               std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+           while (std::chrono::steady_clock::now() < until) {
+           }
+         }).ok() &&
+         ok;
+  }
+  ok = executor->WaitAll().ok() && ok;
+  corekit::api::Result<corekit::task::ExecutorLatencyStats> on = executor->QueryLatency();
+  if (!on.ok()) return false;
+  const corekit::task::LatencySummary& run = on.value().run;
+  const corekit::task::LatencySummary& wait = on.value().queue_wait;
+  ok = run.count == static_cast<std::uint64_t>(kTasks) &&
+       wait.count == static_cast<std::uint64_t>(kTasks) && ok;
+  ok = run.p50_ns >= 150000 && run.p50_ns <= run.p99_ns && run.p99_ns <= run.p999_ns &&
+       run.p999_ns <= run.max_ns && run.mean_ns >= 150000 && ok;
+  ok = wait.p50_ns <= wait.p99_ns && wait.p99_ns <= wait.max_ns && ok;
+
+  std::uint64_t tasks = 0;
+  std::uint64_t busy = 0;
+  for (std::size_t i = 0; i < on.value().workers.size(); ++i) {
+    tasks += on.value().workers[i].tasks;
+    busy += on.value().workers[i].busy_ns;
+  }
+  ok = on.value().workers.size() >= 2 && tasks == static_cast<std::uint64_t>(kTasks) &&
+       busy >= static_cast<std::uint64_t>(kTasks) * 150000 && ok;
+
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorCancellationDeadline() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 1;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 单工作线程被阻塞期间排队的任务：令牌被取消 / 截止时间已过的在出队时丢弃。
+  std::atomic<bool> release(false);
+  bool ok = executor->Submit([&release]() {
+                       while (!release.load()) std::this_thread::yield();
+                     }).ok();
+  corekit::task::CancellationSource source;
+  corekit::task::TaskSubmitOptions canceled_opt;
+  canceled_opt.cancel_token = source.Token();
+  corekit::task::TaskSubmitOptions expired_opt;
+  expired_opt.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(5);
+  corekit::task::TaskSubmitOptions live_opt;
+  live_opt.deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+  live_opt.cancel_token = corekit::task::CancellationSource().Token();
+
+  std::atomic<int> ran(0);
+  corekit::api::Result<corekit::task::TaskId> by_token =
+      executor->SubmitEx([&ran]() { ran.fetch_add(1); }, canceled_opt);
+  corekit::api::Result<corekit::task::TaskId> by_deadline =
+      executor->SubmitEx([&ran]() { ran.fetch_add(1); }, expired_opt);
+  ok = executor->SubmitEx([&ran]() { ran.fetch_add(100); }, live_opt).ok() && ok;
+  ok = executor->SubmitTask(corekit::task::TaskFunction([&ran]() { ran.fetch_add(1); }),
+                            expired_opt, NULL)
+           .ok() &&
+       ok;
+  ok = by_token.ok() && by_deadline.ok() && ok;
+  if (!ok) {
+    release.store(true);
+    corekit_destroy_executor(executor);
+    return false;
+  }
+  source.Cancel();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  release.store(true);
+  ok = executor->Wait(by_token.value(), 5000).ok() && ok;
+  ok = executor->Wait(by_deadline.value(), 5000).ok() && ok;
+  ok = executor->WaitAll().ok() && ran.load() == 100 && ok;
+  corekit::api::Result<bool> token_ok = executor->IsTaskSucceeded(by_token.value());
+  corekit::api::Result<bool> deadline_ok = executor->IsTaskSucceeded(by_deadline.value());
+  ok = token_ok.ok() && !token_ok.value() && deadline_ok.ok() && !deadline_ok.value() && ok;
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  ok = stats.ok() && stats.value().canceled == 1 && stats.value().expired == 2 &&
+       stats.value().completed == 2 && ok;
+
+  // 运行中的任务轮询令牌，取消后自行提前返回。
+  corekit::task::CancellationSource running_source;
+  corekit::task::TaskSubmitOptions running_opt;
+  running_opt.cancel_token = running_source.Token();
+  const corekit::task::CancellationToken token = running_opt.cancel_token;
+  std::atomic<bool> started(false);
+  corekit::api::Result<corekit::task::TaskId> running = executor->SubmitEx(
+      [token, &started]() {
+        started.store(true);
+        while (!token.IsCancellationRequested()) std::this_thread::yield();
+      },
+      running_opt);
+  ok = running.ok() && ok;
+  if (!ok) {
+    running_source.Cancel();
+    corekit_destroy_executor(executor);
+    return false;
+  }
+  while (!started.load()) std::this_thread::yield();
+  running_source.Cancel();
+  ok = executor->Wait(running.value(), 5000).ok() && ok;
+
+  // 周期任务：令牌取消后整个序列结束，Wait 返回。
+  corekit::task::CancellationSource periodic_source;
+  corekit::task::TaskSubmitOptions periodic_opt;
+  periodic_opt.cancel_token = periodic_source.Token();
+  std::atomic<int> ticks(0);
+  corekit::api::Result<corekit::task::TaskId> periodic =
+      executor->SubmitEvery(2, [&ticks]() { ticks.fetch_add(1); }, periodic_opt);
+  ok = periodic.ok() && ok;
+  if (!ok) {
+    corekit_destroy_executor(executor);
+    return false;
+  }
+  for (int i = 0; i < 2000 && ticks.load() < 2; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  periodic_source.Cancel();
+  ok = ticks.load() >= 2 && executor->Wait(periodic.value(), 5000).ok() && ok;
+
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorOverflowPolicies() {
+  typedef corekit::task::OverflowPolicy OverflowPolicy;
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 1;
+  opt.queue_capacity = 2;
+  opt.overflow_policy = OverflowPolicy::kBlock;
+  opt.block_timeout_ms = 20;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 唯一的工作线程被阻塞，排队的两个任务占满容量。
+  std::atomic<bool> release(false);
+  std::atomic<int> ran(0);
+  bool ok = executor->Submit([&release]() {
+                       while (!release.load()) std::this_thread::yield();
+                     }).ok();
+  for (int i = 0; i < 100 && executor->QueryStats().value().queue_depth > 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  corekit::task::TaskSubmitOptions low;
+  low.priority = corekit::task::TaskPriority::kLow;
+  corekit::task::TaskSubmitOptions high;
+  high.priority = corekit::task::TaskPriority::kHigh;
+  corekit::api::Result<corekit::task::TaskId> low_id =
+      executor->SubmitEx([&ran]() { ran.fetch_add(1); }, low);
+  ok = low_id.ok() && executor->Submit([&ran]() { ran.fetch_add(1); }).ok() && ok;
+
+  // kBlock：等待超时后返回 kWouldBlock；等待期间腾出空位则成功入队。
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  ok = executor->Submit([&ran]() { ran.fetch_add(1); }).code() ==
+           corekit::api::StatusCode::kWouldBlock &&
+       std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20) && ok;
+  opt.block_timeout_ms = 0;
+  ok = executor->Reconfigure(opt).ok() && ok;
+  std::thread releaser([&release]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    release.store(true);
+  });
+  ok = executor->Submit([&ran]() { ran.fetch_add(1); }).ok() && ok;
+  releaser.join();
+  ok = executor->WaitAll().ok() && ran.load() == 3 && ok;
+
+  // kCallerRuns：队列满时在提交线程上执行，不计入拒绝。
+  release.store(false);
+  opt.overflow_policy = OverflowPolicy::kCallerRuns;
+  ok = executor->Reconfigure(opt).ok() && ok;
+  ok = executor->Submit([&release]() {
+         while (!release.load()) std::this_thread::yield();
+       }).ok() &&
+       ok;
+  for (int i = 0; i < 100 && executor->QueryStats().value().queue_depth > 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  // 带 id 提交：kDropOldestLowPriority 只挤出带 TaskId 的任务（见下）。
+  corekit::task::TaskSubmitOptions normal;
+  ok = executor->SubmitEx([]() {}, normal).ok() && executor->SubmitEx([]() {}, normal).ok() && ok;
+  const std::thread::id caller = std::this_thread::get_id();
+  std::atomic<bool> ran_on_caller(false);
+  corekit::api::Result<corekit::task::TaskId> inline_id = executor->SubmitEx(
+      [&ran_on_caller, caller]() { ran_on_caller.store(std::this_thread::get_id() == caller); },
+      corekit::task::TaskSubmitOptions());
+  ok = inline_id.ok() && ran_on_caller.load() && ok;
+  corekit::api::Result<bool> inline_ok =
+      inline_id.ok() ? executor->IsTaskSucceeded(inline_id.value())
+                     : corekit::api::Result<bool>(false);
+  ok = inline_ok.ok() && inline_ok.value() && ok;
+
+  // kDropOldestLowPriority：高优先级任务挤出最老的低优先级任务；没有可挤出的任务时拒绝。
+  opt.overflow_policy = OverflowPolicy::kDropOldestLowPriority;
+  ok = executor->Reconfigure(opt).ok() && ok;
+  // 队列中现有两个 kNormal 任务：kLow 无可挤出对象，kHigh 挤出较早的 kNormal。
+  ok = executor->SubmitEx([]() {}, low).status().code() ==
+           corekit::api::StatusCode::kWouldBlock &&
+       ok;
+  ok = executor->SubmitEx([]() {}, high).ok() && ok;
+  release.store(true);
+  ok = executor->WaitAll().ok() && ok;
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  ok = stats.ok() && stats.value().caller_runs == 1 && stats.value().dropped == 1 &&
+       stats.value().rejected == 2 && ok;
+  corekit_destroy_executor(executor);
+
+  // 按优先级限速：kLow 每秒 20 个、突发 2 个；其他优先级不受影响。
+  corekit::task::ExecutorOptions limited;
+  limited.worker_count = 1;
+  limited.rate_limit_per_sec[0] = 20;
+  limited.rate_burst[0] = 2;
+  executor = corekit_create_executor_v2(&limited);
+  if (executor == NULL) return false;
+  ok = executor->SubmitEx([]() {}, low).ok() && executor->SubmitEx([]() {}, low).ok() && ok;
+  ok = executor->SubmitEx([]() {}, low).status().code() ==
+           corekit::api::StatusCode::kWouldBlock &&
+       ok;
+  ok = executor->Submit([]() {}).ok() && ok;
+  // kBlock 下等待令牌补充而不是拒绝。
+  limited.overflow_policy = OverflowPolicy::kBlock;
+  ok = executor->Reconfigure(limited).ok() && ok;
+  start = std::chrono::steady_clock::now();
+  ok = executor->SubmitEx([]() {}, low).ok() && ok;
+  ok = std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20) && ok;
+  ok = executor->WaitAll().ok() && ok;
+  stats = executor->QueryStats();
+  ok = stats.ok() && stats.value().throttled == 2 && stats.value().rejected == 1 &&
+       stats.value().completed == 4 && ok;
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorDropSparesUntrackedTasks() {
+  // 未分配 TaskId 的任务（任务图节点等）在 kDropOldestLowPriority 下不会被挤出，
+  // 否则图中的节点永不执行，RunWithExecutor 永不返回。
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 1;
+  opt.queue_capacity = 3;
+  opt.overflow_policy = corekit::task::OverflowPolicy::kDropOldestLowPriority;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  corekit::task::ITaskGraph* graph = corekit_create_task_graph();
+  if (executor == NULL || graph == NULL) return false;
+
+  std::atomic<bool> started(false);
+  std::atomic<bool> release(false);
+  bool ok = executor->Submit([&started, &release]() {
+                       started.store(true);
+                       while (!release.load()) std::this_thread::yield();
+                     }).ok();
+  while (!started.load()) std::this_thread::yield();
+
+  std::atomic<int> graph_runs(0);
+  ok = graph->AddTask([&graph_runs]() { graph_runs.fetch_add(1); }).ok() && ok;
+  ok = graph->AddTask([&graph_runs]() { graph_runs.fetch_add(1); }).ok() && ok;
+  corekit::task::TaskSubmitOptions low;
+  low.priority = corekit::task::TaskPriority::kLow;
+  corekit::task::TaskSubmitOptions high;
+  high.priority = corekit::task::TaskPriority::kHigh;
+  std::atomic<int> high_accepted(0);
+  std::thread submitter([&]() {
+    // 两个图节点入队后，再放入一个带 id 的 kLow 任务占满容量，随后连续提交三个 kHigh。
+    while (executor->QueryStats().value().queue_depth < 2) std::this_thread::yield();
+    executor->SubmitEx([]() {}, low);
+    for (int i = 0; i < 3; ++i) {
+      if (executor->SubmitEx([]() {}, high).ok()) high_accepted.fetch_add(1);
+    }
+    release.store(true);
+  });
+  corekit::task::GraphRunOptions options;
+  options.schedule = corekit::task::GraphSchedule::kFifo;
+  corekit::api::Result<corekit::task::GraphRunStats> run =
+      graph->RunWithExecutor(executor, options);
+  submitter.join();
+  ok = run.ok() && run.value().succeeded == 2 && graph_runs.load() == 2 && ok;
+  ok = executor->WaitAll().ok() && ok;
+  // 每个 kHigh 都挤出一个带 id 的任务（kLow，之后是较早的 kHigh），图节点始终保留。
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  ok = stats.ok() && stats.value().dropped == 3 && high_accepted.load() == 3 && ok;
+
+  corekit_destroy_task_graph(graph);
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestExecutorInjectionQueue() {
+  // MPMC 队列：单线程严格 FIFO，满时拒绝；多生产者多消费者下每个元素恰好取出一次。
+  corekit::task::MpmcQueue<std::uintptr_t> queue(5);
+  bool ok = queue.Capacity() == 8;
+  for (std::uintptr_t i = 1; i <= 8; ++i) ok = queue.TryPush(i) && ok;
+  ok = !queue.TryPush(9) && queue.SizeApprox() == 8 && ok;
+  for (std::uintptr_t i = 1; i <= 8; ++i) {
+    std::uintptr_t v = 0;
+    ok = queue.TryPop(&v) && v == i && ok;
+  }
+  std::uintptr_t none = 0;
+  ok = !queue.TryPop(&none) && queue.EmptyApprox() && ok;
+
+  const int kThreads = 4;
+  const std::uintptr_t kPerProducer = 20000;
+  corekit::task::MpmcQueue<std::uintptr_t> shared(64);
+  std::atomic<std::uint64_t> sum(0);
+  std::atomic<std::uint64_t> popped(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.push_back(std::thread([&shared, t, kPerProducer]() {
+      for (std::uintptr_t i = 1; i <= kPerProducer; ++i) {
+        while (!shared.TryPush(i + static_cast<std::uintptr_t>(t) * kPerProducer)) {
+          std::this_thread::yield();
+        }
+      }
+    }));
+    threads.push_back(std::thread([&shared, &sum, &popped, kThreads, kPerProducer]() {
+      const std::uint64_t total = static_cast<std::uint64_t>(kThreads) * kPerProducer;
+      while (popped.load() < total) {
+        std::uintptr_t v = 0;
+        if (shared.TryPop(&v)) {
+          sum.fetch_add(v);
+          popped.fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+  for (std::size_t i = 0; i < threads.size(); ++i) threads[i].join();
+  const std::uint64_t n = static_cast<std::uint64_t>(kThreads) * kPerProducer;
+  ok = popped.load() == n && sum.load() == n * (n + 1) / 2 && ok;
+
+  // kWorkStealing：多个外部线程并发提交（含超出注入队列容量的积压）全部执行完毕。
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  opt.backend = corekit::task::ExecutorBackend::kWorkStealing;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  std::atomic<bool> release(false);
+  std::atomic<int> ran(0);
+  for (int i = 0; i < 2; ++i) {
+    ok = executor->Submit([&release]() {
+           while (!release.load()) std::this_thread::yield();
+         }).ok() &&
+         ok;
+  }
+  const int kPerThread = 2000;
+  std::atomic<int> submitted(0);
+  threads.clear();
+  for (int t = 0; t < kThreads; ++t) {
+    threads.push_back(std::thread([executor, &ran, &submitted, t]() {
+      corekit::task::TaskSubmitOptions options;
+      options.priority = static_cast<corekit::task::TaskPriority>(t % 3);
+      for (int i = 0; i < kPerThread; ++i) {
+        if (i % 100 == 0) {
+          corekit::task::TaskFunction fns[4] = {
+              corekit::task::TaskFunction([&ran]() { ran.fetch_add(1); }),
+              corekit::task::TaskFunction([&ran]() { ran.fetch_add(1); }),
+              corekit::task::TaskFunction([&ran]() { ran.fetch_add(1); }),
+              corekit::task::TaskFunction([&ran]() { ran.fetch_add(1); })};
+          if (executor->SubmitBatch(fns, 4, options, NULL).ok()) submitted.fetch_add(4);
+        } else if (executor
+                       ->SubmitTask(corekit::task::TaskFunction([&ran]() { ran.fetch_add(1); }),
+                                    options, NULL)
+                       .ok()) {
+          submitted.fetch_add(1);
+        }
+      }
+    }));
+  }
+  for (std::size_t i = 0; i < threads.size(); ++i) threads[i].join();
+  release.store(true);
+  ok = executor->WaitAll().ok() && ok;
+  ok = submitted.load() == kThreads * (kPerThread + kPerThread / 100 * 3) &&
+       ran.load() == submitted.load() && ok;
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  ok = stats.ok() && stats.value().queue_depth == 0 && ok;
+  corekit_destroy_executor(executor);
+
+  // kFifo 下外部提交不走按优先级分道的注入队列，仍按提交顺序执行。
+  opt.worker_count = 1;
+  opt.policy = corekit::task::ExecutorPolicy::kFifo;
+  executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  std::atomic<bool> started(false);
+  release.store(false);
+  ok = executor->Submit([&started, &release]() {
+         started.store(true);
+         while (!release.load()) std::this_thread::yield();
+       }).ok() &&
+       ok;
+  while (!started.load()) std::this_thread::yield();
+  std::mutex order_mu;
+  std::string order;
+  const char tags[] = "lhn";
+  const corekit::task::TaskPriority priorities[] = {corekit::task::TaskPriority::kLow,
+                                                    corekit::task::TaskPriority::kHigh,
+                                                    corekit::task::TaskPriority::kNormal};
+  for (int i = 0; i < 3; ++i) {
+    corekit::task::TaskSubmitOptions options;
+    options.priority = priorities[i];
+    const char tag = tags[i];
+    ok = executor->SubmitEx([&order_mu, &order, tag]() {
+           std::lock_guard<std::mutex> lock(order_mu);
+           order.push_back(tag);
+         }, options).ok() &&
+         ok;
+  }
+  release.store(true);
+  ok = executor->WaitAll().ok() && order == "lhn" && ok;
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+#if defined(COREKIT_ENABLE_COROUTINES) && COREKIT_ENABLE_COROUTINES && \
+    defined(__cpp_impl_coroutine)
+namespace {
+
+corekit::task::Task<int> CoValue(corekit::task::IExecutor* executor, int v) {
+  co_await corekit::task::Schedule(executor);
+  co_return v;
+}
+
+corekit::task::Task<int> CoSum(corekit::task::IExecutor* executor) {
+  const int a = co_await CoValue(executor, 6);
+  co_await corekit::task::SleepFor(executor, 1);
+  const int b = co_await CoValue(executor, 36);
+  co_return a + b;
+}
+
+corekit::task::Task<> CoThrow(corekit::task::IExecutor* executor) {
+  co_await corekit::task::Schedule(executor);
+  throw std::runtime_error("coroutine failure");
+}
+
+corekit::task::Task<bool> CoCatch(corekit::task::IExecutor* executor) {
+  try {
+    co_await CoThrow(executor);
+  } catch (const std::runtime_error&) {
+    co_return true;
+  }
+  co_return false;
+}
+
+// 以已取消的令牌切换线程：仍会恢复，Schedule 返回错误。
+corekit::task::Task<bool> CoScheduleCanceled(corekit::task::IExecutor* executor,
+                                             corekit::task::TaskSubmitOptions options) {
+  corekit::api::Status st = co_await corekit::task::Schedule(executor, options);
+  co_return !st.ok();
+}
+
+corekit::task::Task<> CoCount(corekit::task::IExecutor* executor, std::atomic<int>* done) {
+  co_await corekit::task::SleepFor(executor, 2);
+  done->fetch_add(1);
+}
+
+// 只实现 TryRecv 的内存通道：ready 置位前始终返回 kWouldBlock。
+class FakeChannel : public corekit::ipc::IChannel {
+ public:
+  FakeChannel() : ready(false), polls(0) {}
+  const char* Name() const override { return "fake_channel"; }
+  std::uint32_t ApiVersion() const override { return corekit::api::kApiVersion; }
+  void Release() override {}
+  corekit::api::Status OpenServer(const corekit::ipc::ChannelOptions&) override {
+    return corekit::api::Status::Ok();
+  }
+  corekit::api::Status OpenClient(const corekit::ipc::ChannelOptions&) override {
+    return corekit::api::Status::Ok();
+  }
+  corekit::api::Status Close() override { return corekit::api::Status::Ok(); }
+  corekit::api::Status TrySend(const void*, std::uint32_t) override {
+    return corekit::api::Status::Ok();
+  }
+  corekit::api::Result<std::uint32_t> TryRecv(void* buffer, std::uint32_t size) override {
+    polls.fetch_add(1);
+    if (!ready.load()) {
+      return corekit::api::Result<std::uint32_t>(corekit::api::Status::FromModule(
+          corekit::api::StatusCode::kWouldBlock, "empty", corekit::api::ErrorModule::kIpc));
+    }
+    const char text[] = "ping";
+    if (size < sizeof(text)) return corekit::api::Result<std::uint32_t>(0u);
+    std::memcpy(buffer, text, sizeof(text));
+    return corekit::api::Result<std::uint32_t>(static_cast<std::uint32_t>(sizeof(text)));
+  }
+  corekit::ipc::ChannelStats GetStats() const override { return corekit::ipc::ChannelStats(); }
+
+  std::atomic<bool> ready;
+  std::atomic<int> polls;
+};
+
+corekit::task::Task<std::uint32_t> CoRecv(corekit::task::IExecutor* executor,
+                                          FakeChannel* channel, char* buffer) {
+  corekit::api::Result<std::uint32_t> r =
+      co_await corekit::task::RecvAsync(executor, channel, buffer, 16, 1);
+  co_return r.ok() ? r.value() : 0;
+}
+
+}  // namespace
+
+bool TestExecutorCoroutines() {
+  corekit::task::ExecutorOptions opt;
+  opt.worker_count = 2;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+
+  // 子协程的结果经 co_await 直接交给父协程，异常在 co_await 处重新抛出。
+  corekit::api::Result<int> sum = corekit::task::Spawn(executor, CoSum(executor)).Get();
+  bool ok = sum.ok() && sum.value() == 42;
+  corekit::api::Result<bool> caught = corekit::task::Spawn(executor, CoCatch(executor)).Get();
+  ok = caught.ok() && caught.value() && ok;
+  ok = corekit::task::Spawn(executor, CoThrow(executor)).Get().code() ==
+           corekit::api::StatusCode::kInternalError &&
+       ok;
+
+  // 令牌已取消 / 截止时间已过：Spawn 的 Future 以错误完成，协程帧被释放而不是永远挂起。
+  corekit::task::CancellationSource source;
+  source.Cancel();
+  corekit::task::TaskSubmitOptions canceled;
+  canceled.cancel_token = source.Token();
+  corekit::task::TaskSubmitOptions expired;
+  expired.deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
+  corekit::task::Future<int> canceled_spawn =
+      corekit::task::Spawn(executor, CoValue(executor, 1), canceled);
+  corekit::task::Future<int> expired_spawn =
+      corekit::task::Spawn(executor, CoValue(executor, 1), expired);
+  ok = canceled_spawn.Wait(5000).ok() && expired_spawn.Wait(5000).ok() && ok;
+  ok = canceled_spawn.Get().status().code() == corekit::api::StatusCode::kInternalError &&
+       expired_spawn.Get().status().code() == corekit::api::StatusCode::kInternalError && ok;
+  corekit::task::Future<bool> resumed =
+      corekit::task::Spawn(executor, CoScheduleCanceled(executor, canceled));
+  ok = resumed.Wait(5000).ok() && resumed.Get().ok() && resumed.Get().value() && ok;
+
+  // 两个工作线程承载上千个同时挂起的协程。
+  const int kCoroutines = 2000;
+  std::atomic<int> done(0);
+  std::vector<corekit::task::Future<void> > futures;
+  for (int i = 0; i < kCoroutines; ++i) {
+    futures.push_back(corekit::task::Spawn(executor, CoCount(executor, &done)));
+  }
+  for (std::size_t i = 0; i < futures.size(); ++i) ok = futures[i].Get().ok() && ok;
+  ok = done.load() == kCoroutines && ok;
+
+  // 通道无消息时经时间轮轮询，不占用工作线程。
+  FakeChannel channel;
+  char buffer[16] = {0};
+  corekit::task::Future<std::uint32_t> received =
+      corekit::task::Spawn(executor, CoRecv(executor, &channel, buffer));
+  for (int i = 0; i < 1000 && channel.polls.load() < 3; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ok = !received.IsReady() && ok;
+  channel.ready.store(true);
+  corekit::api::Result<std::uint32_t> bytes = received.Get();
+  ok = bytes.ok() && bytes.value() == 5 && std::strcmp(buffer, "ping") == 0 && ok;
+  corekit_destroy_executor(executor);
+
+  // SleepFor 到期时队列已满：恢复改在定时线程上执行，不会被丢弃。
+  opt.worker_count = 1;
+  opt.queue_capacity = 1;
+  executor = corekit_create_executor_v2(&opt);
+  if (executor == NULL) return false;
+  std::atomic<bool> started(false);
+  std::atomic<bool> release(false);
+  ok = executor->Submit([&started, &release]() {
+         started.store(true);
+         while (!release.load()) std::this_thread::yield();
+       }).ok() &&
+       ok;
+  while (!started.load()) std::this_thread::yield();
+  ok = executor->Submit([]() {}).ok() && ok;
+  std::atomic<int> slept(0);
+  corekit::task::Future<void> sleeper = corekit::task::Spawn(executor, CoCount(executor, &slept));
+  ok = sleeper.Wait(5000).ok() && sleeper.Get().ok() && slept.load() == 1 && ok;
+  corekit::api::Result<corekit::task::ExecutorStats> stats = executor->QueryStats();
+  ok = stats.ok() && stats.value().caller_runs >= 1 && ok;
+  release.store(true);
+  ok = executor->WaitAll().ok() && ok;
+  corekit_destroy_executor(executor);
+  return ok;
+}
+#endif
+
 bool TestTaskGraphDependency() {
   corekit::task::ITaskGraph* graph = corekit_create_task_graph();
   if (graph == NULL) return false;
@@ -340,6 +1863,429 @@ bool TestTaskGraphValidateAndRunWithExecutor() {
   return v.load(std::memory_order_relaxed) == 3;
 }
 
+bool TestTaskGraphDataflow() {
+  corekit::task::ExecutorOptions eopt;
+  eopt.worker_count = 2;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&eopt);
+  corekit::task::ITaskGraph* graph = corekit_create_task_graph();
+  if (graph == NULL || executor == NULL) return false;
+
+  // slow → after_slow 与 b1 → b2 → b3 两条独立分支：b2/b3 不应等待同层的 slow 完成。
+  std::atomic<bool> slow_done(false);
+  std::atomic<int> b3_saw_slow_done(-1);
+  std::atomic<int> order_errors(0);
+  std::atomic<int> stage(0);
+  corekit::task::TaskId slow = graph->AddTask([&slow_done]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    slow_done.store(true);
+  }).value();
+  corekit::task::TaskId after_slow = graph->AddTask([&slow_done, &order_errors]() {
+    if (!slow_done.load()) order_errors.fetch_add(1);
+  }).value();
+  corekit::task::TaskId b1 = graph->AddTask([&stage]() { stage.store(1); }).value();
+  corekit::task::TaskId b2 = graph->AddTask([&stage, &order_errors]() {
+    if (stage.load() != 1) order_errors.fetch_add(1);
+    stage.store(2);
+  }).value();
+  corekit::task::TaskId b3 = graph->AddTask([&stage, &order_errors, &slow_done,
+                                             &b3_saw_slow_done]() {
+    if (stage.load() != 2) order_errors.fetch_add(1);
+    b3_saw_slow_done.store(slow_done.load() ? 1 : 0);
+  }).value();
+  bool ok = graph->AddDependency(slow, after_slow).ok();
+  ok = graph->AddDependency(b1, b2).ok() && ok;
+  ok = graph->AddDependency(b2, b3).ok() && ok;
+
+  corekit::task::GraphRunOptions options;
+  corekit::api::Result<corekit::task::GraphRunStats> run =
+      graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().succeeded == 5 && run.value().canceled == 0 && ok;
+  ok = order_errors.load() == 0 && b3_saw_slow_done.load() == 0 && ok;
+
+  // 宽扇出 + 汇聚，max_concurrency 限制同时在途的节点数。
+  ok = graph->Clear().ok() && ok;
+  std::atomic<int> running(0);
+  std::atomic<int> peak(0);
+  std::atomic<int> fan_done(0);
+  auto fan_body = [&running, &peak, &fan_done]() {
+    const int now = running.fetch_add(1) + 1;
+    int prev = peak.load();
+    while (now > prev && !peak.compare_exchange_weak(prev, now)) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    running.fetch_sub(1);
+    fan_done.fetch_add(1);
+  };
+  corekit::task::TaskId root = graph->AddTask([]() {}).value();
+  corekit::task::TaskId sink = graph->AddTask([&fan_done, &order_errors]() {
+    if (fan_done.load() != 16) order_errors.fetch_add(1);
+  }).value();
+  for (int i = 0; i < 16; ++i) {
+    corekit::task::TaskId mid = graph->AddTask(fan_body).value();
+    ok = graph->AddDependency(root, mid).ok() && ok;
+    ok = graph->AddDependency(mid, sink).ok() && ok;
+  }
+  options.max_concurrency = 2;
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().succeeded == 18 && ok;
+  ok = order_errors.load() == 0 && peak.load() <= 2 && ok;
+
+  // fail_fast：失败节点的后继不再执行，计入 canceled。
+  ok = graph->Clear().ok() && ok;
+  std::atomic<int> after_fail_runs(0);
+  corekit::task::TaskId bad = graph->AddTask([]() { throw 1; }).value();
+  corekit::task::TaskId child = graph->AddTask([&after_fail_runs]() {
+    after_fail_runs.fetch_add(1);
+  }).value();
+  ok = graph->AddDependency(bad, child).ok() && ok;
+  options.max_concurrency = 0;
+  options.fail_fast = true;
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().failed == 1 && run.value().canceled == 1 && ok;
+  ok = after_fail_runs.load() == 0 && ok;
+
+  corekit_destroy_task_graph(graph);
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestTaskGraphCompileReuse() {
+  corekit::task::IExecutor* executor = corekit_create_executor();
+  corekit::task::ITaskGraph* graph = corekit_create_task_graph();
+  if (graph == NULL || executor == NULL) return false;
+
+  // 菱形 a → {b, c} → d，重复依赖只计一次。
+  std::atomic<int> runs(0);
+  std::atomic<int> order_errors(0);
+  std::atomic<int> mids(0);
+  corekit::task::TaskId a = graph->AddTask([&runs]() { runs.fetch_add(1); }).value();
+  corekit::task::TaskId b = graph->AddTask([&runs, &mids]() {
+    runs.fetch_add(1);
+    mids.fetch_add(1);
+  }).value();
+  corekit::task::TaskId c = graph->AddTask([&runs, &mids]() {
+    runs.fetch_add(1);
+    mids.fetch_add(1);
+  }).value();
+  corekit::task::TaskId d = graph->AddTask([&runs, &mids, &order_errors]() {
+    runs.fetch_add(1);
+    if (mids.load() % 2 != 0) order_errors.fetch_add(1);
+  }).value();
+  bool ok = graph->AddDependency(a, b).ok();
+  ok = graph->AddDependency(a, b).ok() && ok;
+  ok = graph->AddDependency(a, c).ok() && ok;
+  const corekit::task::TaskId befores[] = {b, c};
+  ok = graph->AddDependencies(d, befores, 2).ok() && ok;
+  ok = graph->Compile().ok() && ok;
+  ok = graph->Compile().ok() && ok;
+
+  // 编译后的图重复运行：每次都完整执行一遍。
+  corekit::task::GraphRunOptions options;
+  for (int i = 0; i < 50; ++i) {
+    corekit::api::Result<corekit::task::GraphRunStats> run =
+        graph->RunWithExecutor(executor, options);
+    ok = run.ok() && run.value().succeeded == 4 && ok;
+  }
+  corekit::api::Result<corekit::task::GraphRunStats> inline_run = graph->Run();
+  ok = inline_run.ok() && inline_run.value().succeeded == 4 && ok;
+  ok = runs.load() == 51 * 4 && order_errors.load() == 0 && ok;
+
+  // 编译后修改结构：下次运行自动重新编译，新节点参与执行。
+  corekit::task::TaskId e = graph->AddTask([&runs]() { runs.fetch_add(1); }).value();
+  ok = graph->AddDependency(d, e).ok() && ok;
+  corekit::api::Result<corekit::task::GraphRunStats> rerun =
+      graph->RunWithExecutor(executor, options);
+  ok = rerun.ok() && rerun.value().total == 5 && rerun.value().succeeded == 5 && ok;
+
+  // 引入环后编译失败，运行同样失败。
+  ok = graph->AddDependency(e, a).ok() && ok;
+  ok = graph->Compile().code() == corekit::api::StatusCode::kInvalidArgument && ok;
+  ok = !graph->Run().ok() && ok;
+
+  corekit_destroy_task_graph(graph);
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestTaskGraphCriticalPath() {
+  corekit::task::ExecutorOptions eopt;
+  eopt.worker_count = 1;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&eopt);
+  corekit::task::ITaskGraph* graph = corekit_create_task_graph();
+  if (graph == NULL || executor == NULL) return false;
+
+  std::mutex order_mu;
+  std::string order;
+  auto mark = [&order_mu, &order](char c) {
+    return [&order_mu, &order, c]() {
+      std::lock_guard<std::mutex> lock(order_mu);
+      order.push_back(c);
+    };
+  };
+
+  // 单工作线程：四个短的独立根节点先加入，长链 l → 2 → 3 的根最后加入。
+  // 按 cost_hint 计算的秩使长链先执行，且链上节点优先于等待中的短节点。
+  corekit::task::GraphTaskOptions short_opt;
+  short_opt.cost_hint_us = 10;
+  corekit::task::GraphTaskOptions long_opt;
+  long_opt.cost_hint_us = 1000;
+  bool ok = true;
+  for (int i = 0; i < 4; ++i) ok = graph->AddTask(mark('s'), short_opt).ok() && ok;
+  corekit::task::TaskId l1 = graph->AddTask(mark('l'), short_opt).value();
+  corekit::task::TaskId l2 = graph->AddTask(mark('2'), long_opt).value();
+  corekit::task::TaskId l3 = graph->AddTask(mark('3'), long_opt).value();
+  ok = graph->AddDependency(l1, l2).ok() && ok;
+  ok = graph->AddDependency(l2, l3).ok() && ok;
+
+  corekit::task::GraphRunOptions options;
+  ok = options.schedule == corekit::task::GraphSchedule::kCriticalPath && ok;
+  corekit::api::Result<corekit::task::GraphRunStats> run =
+      graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().succeeded == 7 && ok;
+  ok = order == "l23ssss" && ok;
+
+  // 无 cost_hint：首次运行按节点数计秩（y → z 链优先），之后按实测耗时（慢节点 x 优先）。
+  ok = graph->Clear().ok() && ok;
+  auto slow = mark('x');
+  ok = graph->AddTask([slow]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    slow();
+  }).ok() && ok;
+  corekit::task::TaskId y = graph->AddTask(mark('y')).value();
+  corekit::task::TaskId z = graph->AddTask(mark('z')).value();
+  ok = graph->AddDependency(y, z).ok() && ok;
+  order.clear();
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().succeeded == 3 && order == "yzx" && ok;
+  order.clear();
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().succeeded == 3 && order == "xyz" && ok;
+
+  // kFifo 仍按就绪顺序派发。
+  order.clear();
+  options.schedule = corekit::task::GraphSchedule::kFifo;
+  options.max_concurrency = 1;
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && order == "xyz" && ok;
+  corekit_destroy_executor(executor);
+
+  // 弹性执行器：默认并发上限取 max_workers，放出的节点形成积压，执行器得以扩容。
+  eopt.max_workers = 4;
+  eopt.spawn_queue_depth = 0;
+  executor = corekit_create_executor_v2(&eopt);
+  if (executor == NULL) return false;
+  ok = graph->Clear().ok() && ok;
+  std::atomic<int> running(0);
+  std::atomic<int> max_running(0);
+  for (int i = 0; i < 4; ++i) {
+    ok = graph->AddTask([&running, &max_running]() {
+      const int now = ++running;
+      int seen = max_running.load();
+      while (seen < now && !max_running.compare_exchange_weak(seen, now)) {
+      }
+      const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+      while (max_running.load() < 4 && std::chrono::steady_clock::now() < until) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      --running;
+    }).ok() && ok;
+  }
+  options.schedule = corekit::task::GraphSchedule::kCriticalPath;
+  options.max_concurrency = 0;
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().succeeded == 4 && max_running.load() == 4 && ok;
+
+  corekit_destroy_task_graph(graph);
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestTaskGraphSubflowConditionSubgraph() {
+  corekit::task::IExecutor* executor = corekit_create_executor();
+  corekit::task::ITaskGraph* graph = corekit_create_task_graph();
+  corekit::task::ITaskGraph* child = corekit_create_task_graph();
+  if (graph == NULL || child == NULL || executor == NULL) return false;
+
+  corekit::task::GraphRunOptions options;
+  std::mutex order_mu;
+  std::string order;
+  auto mark = [&order_mu, &order](char c) {
+    return [&order_mu, &order, c]() {
+      std::lock_guard<std::mutex> lock(order_mu);
+      order.push_back(c);
+    };
+  };
+
+  // 条件节点：cond 选第 1 个分支 b1；b0 及只能经由它到达的 s0 被跳过，汇合点 j 照常执行。
+  std::atomic<std::uint32_t> branch(1);
+  corekit::task::TaskId cond =
+      graph->AddConditionTask([&branch]() { return branch.load(); }).value();
+  corekit::task::TaskId b0 = graph->AddTask(mark('0')).value();
+  corekit::task::TaskId b1 = graph->AddTask(mark('1')).value();
+  corekit::task::TaskId s0 = graph->AddTask(mark('s')).value();
+  corekit::task::TaskId j = graph->AddTask(mark('j')).value();
+  bool ok = graph->AddDependency(cond, b0).ok();
+  ok = graph->AddDependency(cond, b1).ok() && ok;
+  ok = graph->AddDependency(b0, s0).ok() && ok;
+  ok = graph->AddDependency(b0, j).ok() && ok;
+  ok = graph->AddDependency(b1, j).ok() && ok;
+  corekit::api::Result<corekit::task::GraphRunStats> run =
+      graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().total == 5 && run.value().succeeded == 3 &&
+       run.value().skipped == 2 && run.value().canceled == 0 && order == "1j" && ok;
+  order.clear();
+  run = graph->Run();
+  ok = run.ok() && run.value().succeeded == 3 && run.value().skipped == 2 && order == "1j" && ok;
+
+  // 越界的返回值不激活任何分支：其余节点全部跳过。
+  order.clear();
+  branch.store(7);
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().succeeded == 1 && run.value().skipped == 4 && order.empty() && ok;
+
+  // 动态节点：派生的子任务与子图全部结束后，后继才执行。
+  std::atomic<int> spawned(0);
+  std::atomic<int> child_runs(0);
+  for (int i = 0; i < 3; ++i) {
+    ok = child->AddTask([&child_runs]() { child_runs.fetch_add(1); }).ok() && ok;
+  }
+  std::atomic<int> spawn_errors(0);
+  std::atomic<int> order_errors(0);
+  ok = graph->Clear().ok() && ok;
+  corekit::task::TaskId dyn = graph->AddDynamicTask([&](corekit::task::ISubflow& sf) {
+    for (int i = 0; i < 8; ++i) {
+      if (!sf.Spawn([&spawned]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                spawned.fetch_add(1);
+              }).ok()) {
+        spawn_errors.fetch_add(1);
+      }
+    }
+  }).value();
+  corekit::task::TaskId dyn_graph = graph->AddDynamicTask([&](corekit::task::ISubflow& sf) {
+    if (!sf.SpawnGraph(child).ok() || !sf.SpawnGraph(child).ok()) spawn_errors.fetch_add(1);
+  }).value();
+  corekit::task::TaskId after = graph->AddTask([&]() {
+    if (spawned.load() % 8 != 0 || child_runs.load() % 6 != 0) order_errors.fetch_add(1);
+  }).value();
+  ok = graph->AddDependency(dyn, after).ok() && ok;
+  ok = graph->AddDependency(dyn_graph, after).ok() && ok;
+  // 未编译的子图不能派生：SpawnGraph 返回错误，节点本身照常完成。
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().succeeded == 3 && spawn_errors.load() == 1 && ok;
+  ok = child->Compile().ok() && ok;
+  spawn_errors.store(0);
+  for (int i = 0; i < 20; ++i) {
+    run = graph->RunWithExecutor(executor, options);
+    ok = run.ok() && run.value().total == 3 && run.value().succeeded == 3 && ok;
+  }
+  run = graph->Run();
+  ok = run.ok() && run.value().succeeded == 3 && ok;
+  ok = spawn_errors.load() == 0 && order_errors.load() == 0 && ok;
+
+  // 子工作失败使动态节点失败；fail_fast 下其后继不再执行。
+  corekit::task::TaskId bad = graph->AddDynamicTask([](corekit::task::ISubflow& sf) {
+    sf.Spawn([]() { throw 1; });
+  }).value();
+  std::atomic<int> after_bad(0);
+  corekit::task::TaskId bad_next = graph->AddTask([&after_bad]() { after_bad.fetch_add(1); }).value();
+  ok = graph->AddDependency(bad, bad_next).ok() && ok;
+  options.fail_fast = true;
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().failed == 1 && after_bad.load() == 0 && ok;
+  options.fail_fast = false;
+
+  // 子图节点：展开进父图，子图节点按依赖执行并计入父图统计。
+  ok = graph->Clear().ok() && child->Clear().ok() && ok;
+  corekit::task::TaskId ca = child->AddTask(mark('a')).value();
+  corekit::task::TaskId cb = child->AddTask(mark('b')).value();
+  ok = child->AddDependency(ca, cb).ok() && ok;
+  corekit::task::TaskId p0 = graph->AddTask(mark('<')).value();
+  corekit::task::TaskId sub = graph->AddSubgraph(child).value();
+  corekit::task::TaskId p1 = graph->AddTask(mark('>')).value();
+  ok = graph->AddDependency(p0, sub).ok() && graph->AddDependency(sub, p1).ok() && ok;
+  order.clear();
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().total == 4 && run.value().succeeded == 4 && order == "<ab>" && ok;
+
+  // 子图在父图编译后被修改：父图下次运行时重新展开。
+  corekit::task::TaskId cc = child->AddTask(mark('c')).value();
+  ok = child->AddDependency(cb, cc).ok() && ok;
+  order.clear();
+  run = graph->RunWithExecutor(executor, options);
+  ok = run.ok() && run.value().total == 5 && order == "<abc>" && ok;
+  order.clear();
+  run = graph->Run();
+  ok = run.ok() && run.value().succeeded == 5 && order == "<abc>" && ok;
+
+  // 嵌入自身或相互嵌入均被拒绝。
+  ok = graph->AddSubgraph(graph).status().code() == corekit::api::StatusCode::kInvalidArgument &&
+       ok;
+  ok = graph->AddSubgraph(NULL).status().code() == corekit::api::StatusCode::kInvalidArgument &&
+       ok;
+  ok = child->AddSubgraph(graph).ok() && ok;
+  ok = graph->Validate().code() == corekit::api::StatusCode::kInvalidArgument && ok;
+  ok = graph->Compile().code() == corekit::api::StatusCode::kInvalidArgument && ok;
+
+  corekit_destroy_task_graph(graph);
+  corekit_destroy_task_graph(child);
+  corekit_destroy_executor(executor);
+  return ok;
+}
+
+bool TestTaskGraphZeroAllocRerun() {
+  corekit::task::ExecutorOptions eopt;
+  eopt.worker_count = 2;
+  corekit::task::IExecutor* executor = corekit_create_executor_v2(&eopt);
+  corekit::task::ITaskGraph* graph = corekit_create_task_graph();
+  corekit::task::ITaskGraph* child = corekit_create_task_graph();
+  if (graph == NULL || child == NULL || executor == NULL) return false;
+
+  // 二叉树 + 条件分支 + 嵌入子图，覆盖数据流、跳过传播与占位节点。
+  std::atomic<int> counter(0);
+  auto inc = [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); };
+  bool ok = child->AddTask(inc).ok() && child->AddTask(inc).ok();
+  std::vector<corekit::task::TaskId> ids;
+  for (int i = 0; i < 31; ++i) ids.push_back(graph->AddTask(inc).value());
+  for (int i = 1; i < 31; ++i) ok = graph->AddDependency(ids[(i - 1) / 2], ids[i]).ok() && ok;
+  corekit::task::TaskId cond = graph->AddConditionTask([]() { return 1u; }).value();
+  corekit::task::TaskId skipped = graph->AddTask(inc).value();
+  corekit::task::TaskId sub = graph->AddSubgraph(child).value();
+  ok = graph->AddDependency(ids[0], cond).ok() && ok;
+  ok = graph->AddDependency(cond, skipped).ok() && ok;
+  ok = graph->AddDependency(cond, sub).ok() && ok;
+  ok = graph->Compile().ok() && ok;
+
+  corekit::task::GraphRunOptions critical;
+  corekit::task::GraphRunOptions fifo;
+  fifo.schedule = corekit::task::GraphSchedule::kFifo;
+  fifo.max_concurrency = 1;
+  // 预热：填充执行器任务槽池，并让关键路径秩随实测耗时重算过。
+  for (int i = 0; i < 50; ++i) {
+    ok = graph->RunWithExecutor(executor, critical).ok() && ok;
+    ok = graph->RunWithExecutor(executor, fifo).ok() && ok;
+  }
+
+  g_alloc_count.store(0);
+  g_count_allocs.store(true);
+  for (int i = 0; i < 100; ++i) {
+    corekit::api::Result<corekit::task::GraphRunStats> run =
+        graph->RunWithExecutor(executor, i % 2 == 0 ? critical : fifo);
+    ok = run.ok() && run.value().succeeded == 34 && run.value().skipped == 1 && ok;
+    ok = graph->Run().ok() && ok;
+  }
+  g_count_allocs.store(false);
+
+  corekit_destroy_task_graph(graph);
+  corekit_destroy_task_graph(child);
+  corekit_destroy_executor(executor);
+  if (!ok || counter.load() != 300 * 33) return false;
+#if !defined(_WIN32)
+  if (g_alloc_count.load() != 0) return false;
+#endif
+  return true;
+}
+
 bool TestIpcRoundTripInProcess() {
 #if !defined(_WIN32)
   return true;
@@ -972,12 +2918,41 @@ int main() {
       {"allocator_invalid_args_and_hex_code", TestAllocatorInvalidArgsAndHexCode},
       {"executor_submit_wait", TestExecutorSubmitAndWait},
       {"executor_parallel_for", TestExecutorParallelFor},
+      {"executor_parallel_for_range", TestExecutorParallelForRange},
+      {"executor_parallel_reduce_scan", TestExecutorParallelReduceAndScan},
       {"executor_submit_with_key_and_cancel", TestExecutorSubmitWithKeyAndCancel},
       {"executor_submit_ex_serial_key", TestExecutorSubmitExSerialKey},
+      {"executor_serial_key_strands", TestExecutorSerialKeyStrands},
+      {"executor_dynamic_scaling", TestExecutorDynamicScaling},
+      {"executor_affinity_placement", TestExecutorAffinityPlacement},
       {"executor_wait_all", TestExecutorWaitAll},
       {"executor_priority_policy", TestExecutorPriorityPolicy},
+      {"executor_hybrid_aging", TestExecutorHybridAging},
+      {"executor_work_stealing_backend", TestExecutorWorkStealingBackend},
+      {"executor_wait_strategies", TestExecutorWaitStrategies},
+      {"executor_submit_task_inline", TestExecutorSubmitTaskInline},
+      {"executor_task_id_lifecycle", TestExecutorTaskIdLifecycle},
+      {"executor_wait_batch_latch", TestExecutorWaitBatchLatch},
+      {"executor_submit_batch", TestExecutorSubmitBatch},
+      {"executor_timers", TestExecutorTimers},
+      {"executor_future_then", TestExecutorFutureThen},
+      {"executor_future_long_inline_chain", TestExecutorFutureLongInlineChain},
+      {"executor_latency_stats", TestExecutorLatencyStats},
+      {"executor_cancellation_deadline", TestExecutorCancellationDeadline},
+      {"executor_overflow_policies", TestExecutorOverflowPolicies},
+      {"executor_drop_spares_untracked_tasks", TestExecutorDropSparesUntrackedTasks},
+      {"executor_injection_queue", TestExecutorInjectionQueue},
+#if defined(COREKIT_ENABLE_COROUTINES) && COREKIT_ENABLE_COROUTINES && \
+    defined(__cpp_impl_coroutine)
+      {"executor_coroutines", TestExecutorCoroutines},
+#endif
       {"task_graph_dependency", TestTaskGraphDependency},
       {"task_graph_validate_and_run_with_executor", TestTaskGraphValidateAndRunWithExecutor},
+      {"task_graph_dataflow", TestTaskGraphDataflow},
+      {"task_graph_compile_reuse", TestTaskGraphCompileReuse},
+      {"task_graph_critical_path", TestTaskGraphCriticalPath},
+      {"task_graph_subflow_condition_subgraph", TestTaskGraphSubflowConditionSubgraph},
+      {"task_graph_zero_alloc_rerun", TestTaskGraphZeroAllocRerun},
       {"ipc_roundtrip", TestIpcRoundTripInProcess},
       {"basic_queue", TestBasicConcurrentQueue},
       {"basic_map", TestBasicConcurrentMap},